@@ -0,0 +1,59 @@
+#include "scanner_arena.h"
+
+/**
+ * Allocates an arena able to hold the given number of bytes of blocks.
+ * The arena header lives at the start of the same allocation.
+ */
+ScannerArena* scanner_arena_alloc(size_t size) {
+    size_t header_size = scanner_arena_block_size(sizeof(ScannerArena));
+    uint8_t* memory = malloc(header_size + size);
+
+    ScannerArena* arena = (ScannerArena*)memory;
+    arena->base = memory + header_size;
+    arena->size = size;
+    arena->used = 0;
+    arena->block_count = 0;
+    return arena;
+}
+
+/**
+ * Releases the arena together with every block carved from it.
+ */
+void scanner_arena_free(ScannerArena* arena) {
+    furi_assert(arena);
+    free(arena);
+}
+
+/**
+ * Carves a zeroed block from the arena.
+ * Running out of arena is a sizing bug, blocks must be budgeted before the arena is allocated.
+ */
+void* scanner_arena_alloc_block(ScannerArena* arena, const char* name, size_t size) {
+    furi_assert(arena);
+    size = scanner_arena_block_size(size);
+    furi_check(arena->used + size <= arena->size);
+    furi_check(arena->block_count < SCANNER_ARENA_MAX_BLOCKS);
+
+    void* block = arena->base + arena->used;
+    memset(block, 0, size);
+    arena->used += size;
+    arena->blocks[arena->block_count].name = name;
+    arena->blocks[arena->block_count].size = size;
+    arena->block_count++;
+    return block;
+}
+
+/**
+ * Formats the memory budget: every block, arena usage and remaining heap.
+ */
+void scanner_arena_get_report(const ScannerArena* arena, FuriString* report) {
+    furi_assert(arena);
+    furi_assert(report);
+    furi_string_reset(report);
+    for(uint8_t i = 0; i < arena->block_count; i++) {
+        furi_string_cat_printf(report, "%s: %zu\n", arena->blocks[i].name, arena->blocks[i].size);
+    }
+    furi_string_cat_printf(report, "Arena: %zu / %zu\n", arena->used, arena->size);
+    furi_string_cat_printf(report, "Free heap: %zu\n", memmgr_get_free_heap());
+    furi_string_cat_printf(report, "Max block: %zu\n", memmgr_heap_get_max_free_block());
+}
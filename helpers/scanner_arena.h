@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <furi.h>
+
+#define SCANNER_ARENA_ALIGN      8
+#define SCANNER_ARENA_MAX_BLOCKS 12
+
+/**
+ * A named block carved from the arena, kept for the memory budget report.
+ */
+typedef struct {
+    const char* name;
+    size_t size;
+} ScannerArenaBlock;
+
+/**
+ * Single heap allocation holding all long-lived app memory.
+ * Blocks are carved sequentially and released all at once with the arena.
+ */
+typedef struct {
+    uint8_t* base;
+    size_t size;
+    size_t used;
+    ScannerArenaBlock blocks[SCANNER_ARENA_MAX_BLOCKS];
+    uint8_t block_count;
+} ScannerArena;
+
+/**
+ * Rounds a block size up to the arena alignment.
+ */
+static inline size_t scanner_arena_block_size(size_t size) {
+    return (size + SCANNER_ARENA_ALIGN - 1) & ~(size_t)(SCANNER_ARENA_ALIGN - 1);
+}
+
+ScannerArena* scanner_arena_alloc(size_t size);
+void scanner_arena_free(ScannerArena* arena);
+void* scanner_arena_alloc_block(ScannerArena* arena, const char* name, size_t size);
+void scanner_arena_get_report(const ScannerArena* arena, FuriString* report);
@@ -0,0 +1,97 @@
+#include "scanner_baseline.h"
+
+#include <furi.h>
+#include <toolbox/saved_struct.h>
+
+#define SCANNER_BASELINE_NO_BIN SIZE_MAX
+
+/**
+ * Initializes a baseline over the given data block, with no readings.
+ * The block must hold scanner_baseline_size(bin_count) bytes.
+ */
+void scanner_baseline_init(ScannerBaseline* baseline, uint8_t* data, size_t bin_count, uint8_t bin_shift) {
+    furi_assert(baseline);
+    furi_assert(data);
+    furi_assert(bin_count);
+    baseline->data = data;
+    baseline->peaks = data;
+    baseline->occupancy = data + bin_count;
+    baseline->passes = data + 2 * bin_count;
+    baseline->bin_count = bin_count;
+    baseline->bin_shift = bin_shift;
+    scanner_baseline_reset(baseline);
+}
+
+/**
+ * Clears every reading of the baseline.
+ */
+void scanner_baseline_reset(ScannerBaseline* baseline) {
+    furi_assert(baseline);
+    memset(baseline->data, 0, scanner_baseline_size(baseline->bin_count));
+    baseline->last_busy_bin = SCANNER_BASELINE_NO_BIN;
+}
+
+/**
+ * Raises the peak of the channel bin to the reading if it is stronger, and counts the bin
+ * as busy in this pass. The sweep visits the channels of a bin in a row, so a bin is
+ * counted once per pass.
+ */
+void scanner_baseline_record(ScannerBaseline* baseline, size_t channel, float rssi, bool busy) {
+    furi_assert(baseline);
+    size_t bin = scanner_baseline_bin(baseline, channel);
+    uint8_t level = scanner_baseline_encode(rssi);
+    if(level > baseline->peaks[bin]) {
+        baseline->peaks[bin] = level;
+    }
+    if(busy && bin != baseline->last_busy_bin) {
+        baseline->last_busy_bin = bin;
+        if(baseline->occupancy[bin] < UINT8_MAX) {
+            baseline->occupancy[bin]++;
+        }
+    }
+}
+
+/**
+ * Counts a complete pass. Once the pass count saturates, it is halved together with the
+ * occupancy counts so their ratio keeps following the site.
+ */
+void scanner_baseline_end_pass(ScannerBaseline* baseline) {
+    furi_assert(baseline);
+    baseline->last_busy_bin = SCANNER_BASELINE_NO_BIN;
+    if(*baseline->passes == UINT8_MAX) {
+        *baseline->passes /= 2;
+        for(size_t bin = 0; bin < baseline->bin_count; bin++) {
+            baseline->occupancy[bin] /= 2;
+        }
+    }
+    (*baseline->passes)++;
+}
+
+/**
+ * Loads the baseline from a file.
+ * Fails, leaving the baseline unchanged, when the file is missing or was captured
+ * with another bin layout (a different memory profile).
+ */
+bool scanner_baseline_load(ScannerBaseline* baseline, const char* path) {
+    furi_assert(baseline);
+    baseline->last_busy_bin = SCANNER_BASELINE_NO_BIN;
+    return saved_struct_load(
+        path,
+        baseline->data,
+        scanner_baseline_size(baseline->bin_count),
+        SCANNER_BASELINE_MAGIC,
+        SCANNER_BASELINE_VERSION);
+}
+
+/**
+ * Saves the baseline to a file.
+ */
+bool scanner_baseline_save(const ScannerBaseline* baseline, const char* path) {
+    furi_assert(baseline);
+    return saved_struct_save(
+        path,
+        baseline->data,
+        scanner_baseline_size(baseline->bin_count),
+        SCANNER_BASELINE_MAGIC,
+        SCANNER_BASELINE_VERSION);
+}
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SCANNER_BASELINE_MAGIC   0x42
+#define SCANNER_BASELINE_VERSION 2
+
+// A bin masks new signals once busy in at least 1/SCANNER_BASELINE_OCCUPANCY_DIVIDER of the passes
+#define SCANNER_BASELINE_OCCUPANCY_DIVIDER 4
+
+/**
+ * Per-bin peak RSSI and occupancy profile of a site, used to spot new transmitters.
+ * Each bin groups 2^bin_shift adjacent channels. Peaks are one byte per bin: the peak RSSI
+ * offset by 128 dB, 0 meaning no reading. Occupancy counts the passes in which the bin was
+ * busy, so a transmitter caught once during capture does not mask its bin for good.
+ * Comparisons stay in integer arithmetic for the sweep.
+ *
+ * The data block holds the peaks, then the occupancy counts, then the pass count, and is
+ * saved as is.
+ */
+typedef struct {
+    uint8_t* data;
+    uint8_t* peaks;
+    uint8_t* occupancy;
+    uint8_t* passes;
+    size_t bin_count;
+    uint8_t bin_shift;
+    size_t last_busy_bin;
+} ScannerBaseline;
+
+/**
+ * Returns the size of the data block of a baseline with the given bin count.
+ */
+static inline size_t scanner_baseline_size(size_t bin_count) {
+    return 2 * bin_count + 1;
+}
+
+/**
+ * Encodes an RSSI reading into the baseline byte format, saturating at the ends.
+ */
+static inline uint8_t scanner_baseline_encode(float rssi) {
+    int32_t level = (int32_t)rssi + 128;
+    return level < 1 ? 1 : level > 255 ? 255 : (uint8_t)level;
+}
+
+/**
+ * Returns the bin holding the given channel index.
+ */
+static inline size_t scanner_baseline_bin(const ScannerBaseline* baseline, size_t channel) {
+    size_t bin = channel >> baseline->bin_shift;
+    return bin < baseline->bin_count ? bin : baseline->bin_count - 1;
+}
+
+/**
+ * Returns true when the reading exceeds the baseline peak of its channel by more than the margin.
+ * Channels without a baseline reading, or busy in too few passes to be part of the site,
+ * always exceed it.
+ */
+static inline bool
+    scanner_baseline_exceeds(const ScannerBaseline* baseline, size_t channel, float rssi, uint8_t margin) {
+    size_t bin = scanner_baseline_bin(baseline, channel);
+    uint8_t peak = baseline->peaks[bin];
+    if(peak == 0 || baseline->occupancy[bin] * SCANNER_BASELINE_OCCUPANCY_DIVIDER < *baseline->passes) {
+        return true;
+    }
+    return scanner_baseline_encode(rssi) > peak + margin;
+}
+
+void scanner_baseline_init(ScannerBaseline* baseline, uint8_t* data, size_t bin_count, uint8_t bin_shift);
+void scanner_baseline_reset(ScannerBaseline* baseline);
+void scanner_baseline_record(ScannerBaseline* baseline, size_t channel, float rssi, bool busy);
+void scanner_baseline_end_pass(ScannerBaseline* baseline);
+bool scanner_baseline_load(ScannerBaseline* baseline, const char* path);
+bool scanner_baseline_save(const ScannerBaseline* baseline, const char* path);
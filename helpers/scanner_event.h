@@ -11,4 +11,13 @@ typedef enum {
     // Sensitivity
     ScannerEventDecreaseSensitivity,
     ScannerEventIncreaseSensitivity,
+    // Radio
+    ScannerEventRadioReady,
+    ScannerEventRadioFailed,
+    // Navigation
+    ScannerEventOpenSettings,
+    ScannerEventOpenResults,
+    ScannerEventOpenMemory,
+    // Results
+    ScannerEventListenResult,
 } ScannerEvent;
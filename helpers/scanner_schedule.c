@@ -0,0 +1,120 @@
+#include "scanner_schedule.h"
+#include "scanner_trace.h"
+
+#include <furi.h>
+
+/**
+ * Channel plan of the CC1101 bands, split around the busy ISM/SRD allocations.
+ * Bounds are inclusive.
+ */
+static const struct {
+    uint32_t start;
+    uint32_t end;
+    uint8_t base_weight;
+} scanner_schedule_plan[] = {
+    {300000000, 348000000, 1},
+    {387000000, 433040000, 1},
+    {433050000, 434790000, 4}, // 433 MHz ISM
+    {434800000, 464000000, 1},
+    {779000000, 862990000, 1},
+    {863000000, 870000000, 4}, // 868 MHz SRD
+    {870010000, 901990000, 1},
+    {902000000, 928000000, 2}, // 915 MHz ISM
+};
+
+/**
+ * Recomputes segment weights and dwell from their activity, then rebuilds the visit order
+ * with a smooth weighted round-robin so visits to each segment are evenly interleaved.
+ * Activity is halved on each rebuild so old traffic fades out.
+ */
+static void scanner_schedule_rebuild(ScannerSchedule* schedule) {
+    int16_t current[SCANNER_SCHEDULE_SEGMENTS_MAX] = {0};
+    uint8_t total = 0;
+    uint32_t weights = 0;
+
+    for(uint8_t i = 0; i < schedule->segment_count; i++) {
+        ScannerScheduleSegment* segment = &schedule->segments[i];
+        uint16_t weight = segment->base_weight + segment->activity / SCANNER_SCHEDULE_HITS_PER_WEIGHT;
+        segment->weight = MIN(weight, SCANNER_SCHEDULE_WEIGHT_MAX);
+        segment->dwell = 1 + segment->weight / 4;
+        segment->activity /= 2;
+        total += segment->weight;
+        weights |= (uint32_t)(segment->weight & 0xF) << (i * 4);
+    }
+
+    for(uint8_t slot = 0; slot < total; slot++) {
+        uint8_t pick = 0;
+        for(uint8_t i = 0; i < schedule->segment_count; i++) {
+            current[i] += schedule->segments[i].weight;
+            if(current[i] > current[pick]) {
+                pick = i;
+            }
+        }
+        current[pick] -= total;
+        schedule->order[slot] = pick;
+    }
+
+    schedule->order_size = total;
+    schedule->position = 0;
+    schedule->visits = 0;
+    scanner_trace_record(ScannerTraceEventScheduleRebuild, total, weights);
+}
+
+/**
+ * Initializes the schedule with the default channel plan and no recorded activity.
+ */
+void scanner_schedule_init(ScannerSchedule* schedule) {
+    furi_assert(schedule);
+    schedule->segment_count = COUNT_OF(scanner_schedule_plan);
+    for(uint8_t i = 0; i < schedule->segment_count; i++) {
+        ScannerScheduleSegment* segment = &schedule->segments[i];
+        segment->start = scanner_schedule_plan[i].start;
+        segment->end = scanner_schedule_plan[i].end;
+        segment->cursor = segment->start;
+        segment->base_weight = scanner_schedule_plan[i].base_weight;
+        segment->activity = 0;
+    }
+    scanner_schedule_rebuild(schedule);
+}
+
+/**
+ * Picks the next channel to visit and advances the cursor of its segment in the scan direction.
+ * Returns the segment index, whose dwell gives the number of RSSI samples to take.
+ */
+uint8_t scanner_schedule_next(ScannerSchedule* schedule, bool up, uint32_t step, uint32_t* frequency) {
+    furi_assert(schedule);
+    furi_assert(frequency);
+    if(++schedule->visits >= SCANNER_SCHEDULE_REBUILD_VISITS) {
+        scanner_schedule_rebuild(schedule);
+    }
+
+    uint8_t index = schedule->order[schedule->position];
+    if(++schedule->position == schedule->order_size) {
+        schedule->position = 0;
+    }
+
+    ScannerScheduleSegment* segment = &schedule->segments[index];
+    *frequency = segment->cursor;
+    if(up) {
+        segment->cursor = segment->cursor + step > segment->end ? segment->start : segment->cursor + step;
+    } else {
+        segment->cursor = segment->cursor < segment->start + step ? segment->end : segment->cursor - step;
+    }
+    return index;
+}
+
+/**
+ * Credits a detection to the segment containing the frequency.
+ */
+void scanner_schedule_report_hit(ScannerSchedule* schedule, uint32_t frequency) {
+    furi_assert(schedule);
+    for(uint8_t i = 0; i < schedule->segment_count; i++) {
+        ScannerScheduleSegment* segment = &schedule->segments[i];
+        if(frequency >= segment->start && frequency <= segment->end) {
+            if(segment->activity < UINT16_MAX) {
+                segment->activity++;
+            }
+            return;
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define SCANNER_SCHEDULE_SEGMENTS_MAX    8
+#define SCANNER_SCHEDULE_WEIGHT_MAX      8
+#define SCANNER_SCHEDULE_ORDER_SIZE      (SCANNER_SCHEDULE_SEGMENTS_MAX * SCANNER_SCHEDULE_WEIGHT_MAX)
+#define SCANNER_SCHEDULE_REBUILD_VISITS  256
+#define SCANNER_SCHEDULE_HITS_PER_WEIGHT 4
+
+/**
+ * A contiguous segment of the channel plan.
+ * Busier segments get a higher weight: more visits per round and more RSSI samples per visit.
+ */
+typedef struct {
+    uint32_t start;
+    uint32_t end;
+    uint32_t cursor;
+    uint8_t base_weight;
+    uint8_t weight;
+    uint8_t dwell;
+    uint16_t activity;
+} ScannerScheduleSegment;
+
+/**
+ * Weighted round-robin over the channel plan segments.
+ * The visit order is precomputed so picking the next channel is O(1); it is rebuilt
+ * from the observed activity every SCANNER_SCHEDULE_REBUILD_VISITS visits.
+ */
+typedef struct {
+    ScannerScheduleSegment segments[SCANNER_SCHEDULE_SEGMENTS_MAX];
+    uint8_t segment_count;
+    uint8_t order[SCANNER_SCHEDULE_ORDER_SIZE];
+    uint8_t order_size;
+    uint8_t position;
+    uint16_t visits;
+} ScannerSchedule;
+
+void scanner_schedule_init(ScannerSchedule* schedule);
+uint8_t scanner_schedule_next(ScannerSchedule* schedule, bool up, uint32_t step, uint32_t* frequency);
+void scanner_schedule_report_hit(ScannerSchedule* schedule, uint32_t frequency);
@@ -0,0 +1,70 @@
+#include "scanner_store.h"
+
+#include <furi.h>
+
+/**
+ * Initializes a store over caller-provided entry storage.
+ */
+void scanner_store_init(ScannerStore* store, ScannerStoreEntry* entries, size_t capacity) {
+    furi_assert(store);
+    furi_assert(entries || !capacity);
+    store->entries = entries;
+    store->capacity = capacity;
+    store->count = 0;
+}
+
+/**
+ * Removes all entries from the store.
+ */
+void scanner_store_reset(ScannerStore* store) {
+    furi_assert(store);
+    store->count = 0;
+}
+
+/**
+ * Inserts an entry at its sorted position.
+ * When the store is full the weakest entry is evicted, unless the new entry is weaker still.
+ * Returns false when the entry was dropped.
+ */
+bool scanner_store_add(ScannerStore* store, const ScannerStoreEntry* entry) {
+    furi_assert(store);
+    furi_assert(entry);
+    if(!store->capacity) {
+        return false;
+    }
+
+    if(store->count == store->capacity) {
+        size_t weakest = 0;
+        for(size_t i = 1; i < store->count; i++) {
+            if(store->entries[i].rssi < store->entries[weakest].rssi) {
+                weakest = i;
+            }
+        }
+        if(entry->rssi <= store->entries[weakest].rssi) {
+            return false;
+        }
+        memmove(
+            &store->entries[weakest],
+            &store->entries[weakest + 1],
+            (store->count - weakest - 1) * sizeof(ScannerStoreEntry));
+        store->count--;
+    }
+
+    size_t low = 0;
+    size_t high = store->count;
+    while(low < high) {
+        size_t mid = (low + high) / 2;
+        if(store->entries[mid].frequency < entry->frequency) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    memmove(
+        &store->entries[low + 1],
+        &store->entries[low],
+        (store->count - low) * sizeof(ScannerStoreEntry));
+    store->entries[low] = *entry;
+    store->count++;
+    return true;
+}
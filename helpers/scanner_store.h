@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * An active channel found during a search-and-store pass.
+ * Adjacent hits are merged into one entry spanning their bandwidth.
+ */
+typedef struct {
+    uint32_t frequency;
+    uint32_t bandwidth;
+    float rssi;
+} ScannerStoreEntry;
+
+/**
+ * Bounded list of store entries, kept sorted by ascending frequency.
+ */
+typedef struct {
+    ScannerStoreEntry* entries;
+    size_t capacity;
+    size_t count;
+} ScannerStore;
+
+void scanner_store_init(ScannerStore* store, ScannerStoreEntry* entries, size_t capacity);
+void scanner_store_reset(ScannerStore* store);
+bool scanner_store_add(ScannerStore* store, const ScannerStoreEntry* entry);
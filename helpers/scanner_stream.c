@@ -0,0 +1,224 @@
+#include "scanner_stream.h"
+#include "scanner_trace.h"
+
+#include <furi.h>
+#include <furi_hal_usb_cdc.h>
+
+#define TAG "ScannerStream"
+
+/**
+ * CRC-8 with polynomial 0x07, as used by the frame trailer.
+ */
+static uint8_t scanner_stream_crc8(const uint8_t* data, size_t size) {
+    uint8_t crc = 0;
+    for(size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for(uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/**
+ * Encodes a frame into the given buffer, which must hold SCANNER_STREAM_FRAME_SZ bytes.
+ * Returns the encoded frame size.
+ */
+size_t scanner_stream_frame_encode(
+    uint8_t type,
+    uint8_t sequence,
+    const uint8_t* payload,
+    uint8_t payload_size,
+    uint8_t* frame) {
+    furi_assert(payload_size <= SCANNER_STREAM_PAYLOAD_SZ);
+    furi_assert(frame);
+    frame[0] = SCANNER_STREAM_SYNC_0;
+    frame[1] = SCANNER_STREAM_SYNC_1;
+    frame[2] = type;
+    frame[3] = sequence;
+    frame[4] = payload_size;
+    memcpy(&frame[SCANNER_STREAM_HEADER_SZ], payload, payload_size);
+    frame[SCANNER_STREAM_HEADER_SZ + payload_size] =
+        scanner_stream_crc8(&frame[2], SCANNER_STREAM_HEADER_SZ - 2 + payload_size);
+    return SCANNER_STREAM_HEADER_SZ + payload_size + 1;
+}
+
+/**
+ * Sends the oldest queued frame when the endpoint is free and the host is listening.
+ */
+static void scanner_stream_pump(ScannerStream* stream) {
+    if(stream->tx_busy || !stream->queue_count || !stream->host_ready) {
+        return;
+    }
+    ScannerStreamPacket* packet = &stream->queue[stream->queue_head];
+    stream->tx_busy = true;
+    furi_hal_cdc_send(SCANNER_STREAM_CDC_CHANNEL, packet->data, packet->size);
+    stream->queue_head = (stream->queue_head + 1) % SCANNER_STREAM_QUEUE_SIZE;
+    stream->queue_count--;
+    stream->frames_sent++;
+}
+
+/**
+ * Encodes a frame into the transmit queue and kicks the transmission.
+ * The frame is dropped when the queue is full.
+ */
+static void scanner_stream_enqueue(
+    ScannerStream* stream,
+    uint8_t type,
+    const uint8_t* payload,
+    uint8_t payload_size) {
+    if(stream->queue_count == SCANNER_STREAM_QUEUE_SIZE) {
+        stream->frames_dropped++;
+    } else {
+        uint8_t tail = (stream->queue_head + stream->queue_count) % SCANNER_STREAM_QUEUE_SIZE;
+        ScannerStreamPacket* packet = &stream->queue[tail];
+        packet->size =
+            scanner_stream_frame_encode(type, stream->sequence, payload, payload_size, packet->data);
+        stream->queue_count++;
+    }
+    stream->sequence++;
+    scanner_stream_pump(stream);
+    scanner_trace_record(ScannerTraceEventStreamFrame, stream->queue_count, stream->frames_dropped);
+}
+
+/**
+ * CDC transmit complete callback, called from the USB interrupt.
+ */
+static void scanner_stream_tx_callback(void* context) {
+    ScannerStream* stream = context;
+    stream->tx_busy = false;
+}
+
+/**
+ * CDC state callback: a disconnected host cannot complete a pending transmission.
+ */
+static void scanner_stream_state_callback(void* context, CdcState state) {
+    ScannerStream* stream = context;
+    if(state == CdcStateDisconnected) {
+        stream->host_ready = false;
+        stream->tx_busy = false;
+    }
+}
+
+/**
+ * CDC control line callback: frames are only sent while the host holds DTR.
+ */
+static void scanner_stream_ctrl_line_callback(void* context, CdcCtrlLine ctrl_lines) {
+    ScannerStream* stream = context;
+    stream->host_ready = (ctrl_lines & CdcCtrlLineDTR);
+}
+
+static CdcCallbacks scanner_stream_cdc_callbacks = {
+    .tx_ep_callback = scanner_stream_tx_callback,
+    .rx_ep_callback = NULL,
+    .state_callback = scanner_stream_state_callback,
+    .ctrl_line_callback = scanner_stream_ctrl_line_callback,
+    .config_callback = NULL,
+};
+
+/**
+ * Switches USB to dual CDC and starts streaming on the second interface.
+ * The first interface keeps serving the CLI.
+ * Returns false, with the previous USB configuration restored, when the switch fails.
+ */
+bool scanner_stream_start(ScannerStream* stream) {
+    furi_assert(stream);
+    if(stream->running) {
+        return true;
+    }
+    stream->host_ready = false;
+    stream->tx_busy = false;
+    stream->sequence = 0;
+    stream->batch_size = 0;
+    stream->queue_head = 0;
+    stream->queue_count = 0;
+    stream->frames_sent = 0;
+    stream->frames_dropped = 0;
+
+    stream->previous_usb = furi_hal_usb_get_config();
+    furi_hal_usb_unlock();
+    if(!furi_hal_usb_set_config(&usb_cdc_dual, NULL)) {
+        FURI_LOG_E(TAG, "Failed to switch USB to dual CDC");
+        furi_hal_usb_set_config(stream->previous_usb, NULL);
+        return false;
+    }
+    furi_hal_cdc_set_callbacks(SCANNER_STREAM_CDC_CHANNEL, &scanner_stream_cdc_callbacks, stream);
+    stream->running = true;
+    return true;
+}
+
+/**
+ * Stops streaming and restores the previous USB configuration.
+ */
+void scanner_stream_stop(ScannerStream* stream) {
+    furi_assert(stream);
+    if(!stream->running) {
+        return;
+    }
+    stream->running = false;
+    furi_hal_cdc_set_callbacks(SCANNER_STREAM_CDC_CHANNEL, NULL, NULL);
+    furi_hal_usb_set_config(stream->previous_usb, NULL);
+}
+
+/**
+ * Adds a sweep step to the current batch, queuing the batch once it fills a frame.
+ * The frequency is sent as the index of the nearest grid channel.
+ */
+void scanner_stream_push_step(ScannerStream* stream, uint32_t frequency, float rssi) {
+    furi_assert(stream);
+    if(!stream->running || !stream->host_ready) {
+        stream->batch_size = 0;
+        return;
+    }
+    uint16_t channel = (frequency - SCANNER_STREAM_FREQUENCY_MIN + SCANNER_STREAM_FREQUENCY_STEP / 2) /
+                       SCANNER_STREAM_FREQUENCY_STEP;
+    uint8_t* record = &stream->batch[stream->batch_size];
+    record[0] = channel & 0xFF;
+    record[1] = channel >> 8;
+    record[2] = (uint8_t)(int8_t)CLAMP(rssi, 127.0f, -128.0f);
+    stream->batch_size += SCANNER_STREAM_STEP_SZ;
+
+    if(stream->batch_size + SCANNER_STREAM_STEP_SZ > SCANNER_STREAM_PAYLOAD_SZ) {
+        scanner_stream_flush(stream);
+    } else {
+        scanner_stream_pump(stream);
+    }
+}
+
+/**
+ * Queues a lock event, after any pending steps so the host sees them in order.
+ */
+void scanner_stream_push_lock(ScannerStream* stream, uint32_t frequency, float rssi) {
+    furi_assert(stream);
+    if(!stream->running || !stream->host_ready) {
+        return;
+    }
+    scanner_stream_flush(stream);
+
+    int16_t rssi_cdbm = (int16_t)(rssi * 100.0f);
+    uint8_t payload[6] = {
+        frequency & 0xFF,
+        (frequency >> 8) & 0xFF,
+        (frequency >> 16) & 0xFF,
+        (frequency >> 24) & 0xFF,
+        (uint16_t)rssi_cdbm & 0xFF,
+        (uint16_t)rssi_cdbm >> 8,
+    };
+    scanner_stream_enqueue(stream, ScannerStreamFrameLock, payload, sizeof(payload));
+}
+
+/**
+ * Queues the pending batch of steps, if any, and kicks the transmission.
+ */
+void scanner_stream_flush(ScannerStream* stream) {
+    furi_assert(stream);
+    if(!stream->running) {
+        return;
+    }
+    if(stream->batch_size) {
+        scanner_stream_enqueue(stream, ScannerStreamFrameSteps, stream->batch, stream->batch_size);
+        stream->batch_size = 0;
+    } else {
+        scanner_stream_pump(stream);
+    }
+}
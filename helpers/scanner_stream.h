@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <furi_hal_usb.h>
+
+/**
+ * Scan results streamed over the second USB CDC interface.
+ *
+ * Frame layout, little-endian, at most one USB packet:
+ *   0xA5 0x5A | type | sequence | payload length | payload | CRC-8
+ * The CRC-8 (polynomial 0x07, initial value 0x00) covers type to payload.
+ *
+ * Payloads:
+ *   ScannerStreamFrameSteps: records of channel index (uint16) and RSSI in dBm (int8),
+ *                            channel index = (frequency - SCANNER_STREAM_FREQUENCY_MIN
+ *                                             + SCANNER_STREAM_FREQUENCY_STEP / 2)
+ *                                            / SCANNER_STREAM_FREQUENCY_STEP, the nearest grid channel
+ *   ScannerStreamFrameLock:  frequency in Hz (uint32) and RSSI in cdBm (int16)
+ *
+ * Keep tools/scanner_stream_reader.py in sync.
+ */
+
+#define SCANNER_STREAM_CDC_CHANNEL 1
+#define SCANNER_STREAM_SYNC_0      0xA5
+#define SCANNER_STREAM_SYNC_1      0x5A
+#define SCANNER_STREAM_HEADER_SZ   5
+#define SCANNER_STREAM_FRAME_SZ    64
+#define SCANNER_STREAM_PAYLOAD_SZ  (SCANNER_STREAM_FRAME_SZ - SCANNER_STREAM_HEADER_SZ - 1)
+#define SCANNER_STREAM_STEP_SZ     3
+#define SCANNER_STREAM_QUEUE_SIZE  8
+
+#define SCANNER_STREAM_FREQUENCY_MIN  300000000
+#define SCANNER_STREAM_FREQUENCY_STEP 10000
+
+/**
+ * Enumeration of stream frame types.
+ */
+typedef enum {
+    ScannerStreamFrameSteps = 1,
+    ScannerStreamFrameLock = 2,
+} ScannerStreamFrame;
+
+/**
+ * An encoded frame waiting in the transmit queue.
+ */
+typedef struct {
+    uint8_t data[SCANNER_STREAM_FRAME_SZ];
+    uint8_t size;
+} ScannerStreamPacket;
+
+/**
+ * State of the USB stream: the batch being filled and a queue of encoded frames.
+ * Frames are dropped rather than stalling the sweep when the host does not keep up.
+ */
+typedef struct {
+    bool running;
+    volatile bool host_ready;
+    volatile bool tx_busy;
+    uint8_t sequence;
+    uint8_t batch[SCANNER_STREAM_PAYLOAD_SZ];
+    uint8_t batch_size;
+    ScannerStreamPacket queue[SCANNER_STREAM_QUEUE_SIZE];
+    uint8_t queue_head;
+    uint8_t queue_count;
+    uint32_t frames_sent;
+    uint32_t frames_dropped;
+    FuriHalUsbInterface* previous_usb;
+} ScannerStream;
+
+size_t scanner_stream_frame_encode(
+    uint8_t type,
+    uint8_t sequence,
+    const uint8_t* payload,
+    uint8_t payload_size,
+    uint8_t* frame);
+
+bool scanner_stream_start(ScannerStream* stream);
+void scanner_stream_stop(ScannerStream* stream);
+void scanner_stream_push_step(ScannerStream* stream, uint32_t frequency, float rssi);
+void scanner_stream_push_lock(ScannerStream* stream, uint32_t frequency, float rssi);
+void scanner_stream_flush(ScannerStream* stream);
@@ -0,0 +1,85 @@
+#include "scanner_trace.h"
+
+#include <furi.h>
+#include <furi_hal_cortex.h>
+#include <cli/cli.h>
+
+#define SCANNER_TRACE_CLI_COMMAND "radio_scanner_trace"
+#define SCANNER_TRACE_DUMP_VERSION 1
+
+ScannerTrace scanner_trace = {0};
+
+// Dumps in progress, scanner_trace_deinit waits for them before the ring can be freed
+static uint32_t scanner_trace_readers = 0;
+
+/**
+ * CLI command dumping the trace ring, oldest record first.
+ * Each record is printed as raw hex, decode it with tools/scanner_trace_decode.py.
+ */
+static void scanner_trace_cli_dump(Cli* cli, FuriString* args, void* context) {
+    UNUSED(cli);
+    UNUSED(args);
+    UNUSED(context);
+
+    // Registered before the ring is loaded, so deinit either hides the ring or waits
+    __atomic_fetch_add(&scanner_trace_readers, 1, __ATOMIC_SEQ_CST);
+    ScannerTraceRecord* records = __atomic_load_n(&scanner_trace.records, __ATOMIC_SEQ_CST);
+    if(!records) {
+        printf("Trace is not running\r\n");
+        __atomic_fetch_sub(&scanner_trace_readers, 1, __ATOMIC_SEQ_CST);
+        return;
+    }
+
+    uint32_t head = __atomic_load_n(&scanner_trace.head, __ATOMIC_RELAXED);
+    uint32_t capacity = scanner_trace.mask + 1;
+    uint32_t count = MIN(head, capacity);
+    printf(
+        "RSTRACE %u %lu %lu %lu\r\n",
+        SCANNER_TRACE_DUMP_VERSION,
+        count,
+        head - count,
+        furi_hal_cortex_instructions_per_microsecond() * 1000000);
+    for(uint32_t i = head - count; i != head; i++) {
+        const ScannerTraceRecord* record = &records[i & scanner_trace.mask];
+        printf(
+            "%08lX%04X%04X%08lX\r\n",
+            record->timestamp,
+            record->event,
+            (uint16_t)record->arg0,
+            record->arg1);
+    }
+    printf("RSTRACE END\r\n");
+    __atomic_fetch_sub(&scanner_trace_readers, 1, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * Starts tracing into the given ring and registers the CLI dump command.
+ * The record count must be a power of two.
+ */
+void scanner_trace_init(ScannerTraceRecord* records, size_t count) {
+    furi_assert(records);
+    furi_check(count && (count & (count - 1)) == 0);
+
+    scanner_trace.mask = count - 1;
+    scanner_trace.head = 0;
+    __atomic_store_n(&scanner_trace.records, records, __ATOMIC_RELEASE);
+
+    Cli* cli = furi_record_open(RECORD_CLI);
+    cli_add_command(cli, SCANNER_TRACE_CLI_COMMAND, CliCommandFlagParallelSafe, scanner_trace_cli_dump, NULL);
+    furi_record_close(RECORD_CLI);
+}
+
+/**
+ * Stops tracing and unregisters the CLI dump command.
+ * Waits for a dump in progress, the ring may be freed afterwards.
+ */
+void scanner_trace_deinit(void) {
+    Cli* cli = furi_record_open(RECORD_CLI);
+    cli_delete_command(cli, SCANNER_TRACE_CLI_COMMAND);
+    furi_record_close(RECORD_CLI);
+
+    __atomic_store_n(&scanner_trace.records, NULL, __ATOMIC_SEQ_CST);
+    while(__atomic_load_n(&scanner_trace_readers, __ATOMIC_SEQ_CST)) {
+        furi_delay_ms(1);
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <stm32wbxx.h>
+
+/**
+ * Enumeration of trace events.
+ * Values are part of the dump format, keep tools/scanner_trace_decode.py in sync.
+ */
+typedef enum {
+    // Engine
+    ScannerTraceEventTick, // arg0: scanning, arg1: frequency
+    ScannerTraceEventTune, // arg1: frequency
+    ScannerTraceEventRssi, // arg0: RSSI in cdBm, arg1: frequency
+    ScannerTraceEventLock, // arg0: RSSI in cdBm, arg1: frequency
+    ScannerTraceEventUnlock, // arg1: frequency
+    ScannerTraceEventPeakCentered, // arg0: retunes, arg1: frequency
+    // Power
+    ScannerTraceEventSleep, // arg1: sleep period in ms
+    ScannerTraceEventWake, // arg1: frequency
+    // UI
+    ScannerTraceEventDrawBegin,
+    ScannerTraceEventDrawEnd,
+    ScannerTraceEventInput, // arg0: key, arg1: type
+    // Store
+    ScannerTraceEventStoreHit, // arg0: peak RSSI in cdBm, arg1: peak frequency
+    ScannerTraceEventStorePass, // arg0: result count, arg1: pass start frequency
+    // Stream
+    ScannerTraceEventStreamFrame, // arg0: queued frames, arg1: dropped frames
+    // Schedule
+    ScannerTraceEventScheduleRebuild, // arg0: visits per round, arg1: segment weights, 4 bits each
+    // Baseline
+    ScannerTraceEventBaselinePass, // arg0: completed passes, arg1: pass start frequency
+    ScannerTraceEventBaselineAlert, // arg0: RSSI in cdBm, arg1: frequency
+    // Carrier sense
+    ScannerTraceEventCarrierSense, // arg1: frequency, recorded from the GDO0 interrupt
+    ScannerTraceEventCarrierSenseLock, // arg0: RadioScannerCarrierSenseLock, arg1: frequency
+    // Scope
+    ScannerTraceEventScopeSlice, // arg0: probed channels, arg1: audio interruption in us
+} ScannerTraceEvent;
+
+/**
+ * A single trace record: cycle counter timestamp, event id and two arguments.
+ */
+typedef struct {
+    uint32_t timestamp;
+    uint16_t event;
+    int16_t arg0;
+    uint32_t arg1;
+} ScannerTraceRecord;
+
+/**
+ * Ring buffer of trace records. The capacity is a power of two.
+ */
+typedef struct {
+    ScannerTraceRecord* records;
+    uint32_t mask;
+    uint32_t head;
+} ScannerTrace;
+
+extern ScannerTrace scanner_trace;
+
+/**
+ * Records an event into the trace ring.
+ * Safe to call from any thread or interrupt, does nothing until the ring is initialized.
+ */
+static inline void scanner_trace_record(ScannerTraceEvent event, int16_t arg0, uint32_t arg1) {
+    ScannerTraceRecord* records = scanner_trace.records;
+    if(records) {
+        uint32_t index = __atomic_fetch_add(&scanner_trace.head, 1, __ATOMIC_RELAXED) & scanner_trace.mask;
+        records[index].timestamp = DWT->CYCCNT;
+        records[index].event = event;
+        records[index].arg0 = arg0;
+        records[index].arg1 = arg1;
+    }
+}
+
+/**
+ * Converts an RSSI value to the cdBm representation used in trace arguments.
+ */
+static inline int16_t scanner_trace_rssi(float rssi) {
+    return (int16_t)(rssi * 100.0f);
+}
+
+void scanner_trace_init(ScannerTraceRecord* records, size_t count);
+void scanner_trace_deinit(void);
@@ -1,4 +1,5 @@
 #include "radio_scanner_app_i.h"
+#include "helpers/scanner_trace.h"
 
 #include <furi.h>
 #include <furi_hal.h>
@@ -14,6 +15,16 @@
 static bool radio_scanner_app_custom_event_callback(void* context, uint32_t event) {
     furi_assert(context);
     RadioScannerApp* app = context;
+    if(event == ScannerEventRadioReady) {
+        // Handled here so it is not lost when another scene is in front
+        radio_scanner_start_rx(app);
+        radio_scanner_acquire_speaker(app);
+        app->radio_ready = true;
+        return true;
+    } else if(event == ScannerEventRadioFailed) {
+        view_dispatcher_stop(app->view_dispatcher);
+        return true;
+    }
     return scene_manager_handle_custom_event(app->scene_manager, event);
 }
 
@@ -37,22 +48,117 @@ static void radio_scanner_app_tick_event_callback(void* context) {
     scene_manager_handle_tick_event(app->scene_manager);
 }
 
+/**
+ * Changes the period of the tick event driving the scan engine.
+ * A longer period lets the MCU idle between low-power sweep bursts.
+ * The view dispatcher only reads its tick period when it starts running, so the
+ * tick of its event loop is reprogrammed directly. Must run on the UI thread.
+ */
+void radio_scanner_app_set_tick_period(RadioScannerApp* app, uint32_t period_ms) {
+    furi_assert(app);
+    furi_event_loop_tick_set(
+        view_dispatcher_get_event_loop(app->view_dispatcher),
+        furi_ms_to_ticks(period_ms),
+        radio_scanner_app_tick_event_callback,
+        app);
+}
+
+/**
+ * Radio bring-up thread.
+ * Initializes the SubGHz device while the UI is already running, then notifies the UI thread.
+ * On failure the view dispatcher is stopped and the app exits.
+ * subghz_devices_init loads the device registry and external radio plugins from storage,
+ * so the thread gets the same stack size as the app thread this used to run on.
+ */
+static int32_t radio_scanner_app_radio_thread(void* context) {
+    RadioScannerApp* app = context;
+    if(!radio_scanner_init_subghz(app)) {
+        FURI_LOG_E(TAG, "Failed to initialize SubGHz");
+        view_dispatcher_send_custom_event(app->view_dispatcher, ScannerEventRadioFailed);
+        return 255;
+    }
+#ifdef FURI_DEBUG
+    FURI_LOG_D(TAG, "SubGHz initialized successfully");
+#endif
+    view_dispatcher_send_custom_event(app->view_dispatcher, ScannerEventRadioReady);
+    return 0;
+}
+
+/**
+ * Memory profiles, from the most to the least generous.
+ * Trace sizes must be powers of two. Each baseline bin covers 2^baseline_bin_shift channels.
+ */
+static const RadioScannerMemoryProfile radio_scanner_memory_profiles[] = {
+    {.name = "Full", .trace_size = 256, .store_size = 64, .baseline_bin_shift = 0},
+    {.name = "Reduced", .trace_size = 64, .store_size = 32, .baseline_bin_shift = 2},
+    {.name = "Minimal", .trace_size = 16, .store_size = 8, .baseline_bin_shift = 4},
+};
+
+/**
+ * Returns the number of baseline bins of a memory profile.
+ */
+static size_t radio_scanner_app_baseline_bins(const RadioScannerMemoryProfile* profile) {
+    return (RADIO_SCANNER_CHANNEL_COUNT + (1 << profile->baseline_bin_shift) - 1) >> profile->baseline_bin_shift;
+}
+
+/**
+ * Returns the arena size needed by the blocks of a memory profile.
+ */
+static size_t radio_scanner_app_arena_size(const RadioScannerMemoryProfile* profile) {
+    return scanner_arena_block_size(sizeof(RadioScannerApp)) +
+           scanner_arena_block_size(sizeof(Scanner)) +
+           scanner_arena_block_size(sizeof(ScannerTraceRecord) * profile->trace_size) +
+           scanner_arena_block_size(sizeof(ScannerStoreEntry) * profile->store_size) +
+           scanner_arena_block_size(scanner_baseline_size(radio_scanner_app_baseline_bins(profile)));
+}
+
+/**
+ * Picks the most generous memory profile whose arena fits in the largest free heap block,
+ * leaving RADIO_SCANNER_HEAP_RESERVE for the GUI and firmware services.
+ * Returns NULL when even the smallest profile does not fit.
+ */
+static const RadioScannerMemoryProfile* radio_scanner_app_select_memory_profile() {
+    size_t max_block = memmgr_heap_get_max_free_block();
+    size_t available = max_block > RADIO_SCANNER_HEAP_RESERVE ? max_block - RADIO_SCANNER_HEAP_RESERVE : 0;
+    for(size_t i = 0; i < COUNT_OF(radio_scanner_memory_profiles); i++) {
+        size_t size = scanner_arena_block_size(sizeof(ScannerArena)) +
+                      radio_scanner_app_arena_size(&radio_scanner_memory_profiles[i]);
+        if(size <= available) {
+            return &radio_scanner_memory_profiles[i];
+        }
+    }
+    return NULL;
+}
+
 /**
  * Allocates and initializes a new instance of the RadioScannerApp.
+ * Long-lived memory is carved from a single arena sized according to the free heap.
  * Sets up GUI components, state variables, and input handlers.
  */
 RadioScannerApp* radio_scanner_app_alloc() {
 #ifdef FURI_DEBUG
     FURI_LOG_D(TAG, "Enter radio_scanner_app_alloc");
 #endif
-    RadioScannerApp* app = malloc(sizeof(RadioScannerApp));
-    if(!app) {
-        FURI_LOG_E(TAG, "Failed to allocate RadioScannerApp");
+    uint32_t startup_tick = furi_get_tick();
+    const RadioScannerMemoryProfile* profile = radio_scanner_app_select_memory_profile();
+    if(!profile) {
+        FURI_LOG_E(TAG, "Not enough memory, %zu bytes free", memmgr_get_free_heap());
         return NULL;
     }
+    FURI_LOG_I(TAG, "Memory profile: %s", profile->name);
+
+    ScannerArena* arena = scanner_arena_alloc(radio_scanner_app_arena_size(profile));
+    RadioScannerApp* app = scanner_arena_alloc_block(arena, "App state", sizeof(RadioScannerApp));
+    app->arena = arena;
+    app->memory_profile = profile;
+
+    // Trace
+    app->trace_records = scanner_arena_alloc_block(arena, "Trace ring", sizeof(ScannerTraceRecord) * profile->trace_size);
+    scanner_trace_init(app->trace_records, profile->trace_size);
 
     // GUI
     app->gui = furi_record_open(RECORD_GUI);
+    app->notifications = furi_record_open(RECORD_NOTIFICATION);
 
     // SceneManager
     app->scene_manager = scene_manager_alloc(&radio_scanner_scene_handlers, app);
@@ -63,22 +169,89 @@ RadioScannerApp* radio_scanner_app_alloc() {
     view_dispatcher_set_event_callback_context(app->view_dispatcher, app);
     view_dispatcher_set_custom_event_callback(app->view_dispatcher, radio_scanner_app_custom_event_callback);
     view_dispatcher_set_navigation_event_callback(app->view_dispatcher, radio_scanner_app_back_event_callback);
-    view_dispatcher_set_tick_event_callback(app->view_dispatcher, radio_scanner_app_tick_event_callback, 100);
+    view_dispatcher_set_tick_event_callback(app->view_dispatcher, radio_scanner_app_tick_event_callback, furi_ms_to_ticks(RADIO_SCANNER_TICK_PERIOD_MS));
 
     view_dispatcher_attach_to_gui(app->view_dispatcher, app->gui, ViewDispatcherTypeFullscreen);
 
     // Scanner
-    app->scanner = scanner_view_alloc();
+    app->scanner = scanner_view_alloc(arena);
+    app->frequency_str = furi_string_alloc();
+    app->rssi_str = furi_string_alloc();
+    app->sensitivity_str = furi_string_alloc();
+    app->scanning_str = furi_string_alloc();
+    app->power_str = furi_string_alloc();
     view_dispatcher_add_view(app->view_dispatcher, RadioScannerViewScanner, scanner_view_get_view(app->scanner));
 
+    // Settings
+    app->variable_item_list = variable_item_list_alloc();
+    view_dispatcher_add_view(app->view_dispatcher, RadioScannerViewVariableItemList, variable_item_list_get_view(app->variable_item_list));
+
+    // Results
+    app->submenu = submenu_alloc();
+    view_dispatcher_add_view(app->view_dispatcher, RadioScannerViewSubmenu, submenu_get_view(app->submenu));
+
+    // Memory
+    app->widget = widget_alloc();
+    view_dispatcher_add_view(app->view_dispatcher, RadioScannerViewWidget, widget_get_view(app->widget));
+
     // Init app state
     app->frequency = RADIO_SCANNER_DEFAULT_FREQ;
+    app->lock_frequency = 0;
     app->rssi = RADIO_SCANNER_DEFAULT_RSSI;
     app->sensitivity = RADIO_SCANNER_DEFAULT_SENSITIVITY;
     app->scanning = true;
     app->scan_direction = ScanDirectionUp;
+    app->scan_mode = ScanModeSearch;
+    app->scan_sweep = ScanSweepLinear;
+    scanner_schedule_init(&app->schedule);
+    app->schedule_dwell = 0;
     app->speaker_acquired = false;
     app->radio_device = NULL;
+    app->radio_ready = false;
+    app->startup_tick = startup_tick;
+    app->first_rssi_ms = 0;
+    app->power.enabled = false;
+    app->power.duty_cycle = RADIO_SCANNER_POWER_DEFAULT_DUTY;
+    app->power.asleep = false;
+    app->power.burst_ticks = 0;
+    app->power.phase_start = furi_get_tick();
+    app->power.active_ms = 0;
+    app->power.sleep_ms = 0;
+    app->power.active_current = 0.0f;
+    app->power.sleep_current = 0.0f;
+    app->power.battery_hours = 0;
+    scanner_store_init(&app->store.results, scanner_arena_alloc_block(arena, "Store results", sizeof(ScannerStoreEntry) * profile->store_size), profile->store_size);
+    app->store.run_active = false;
+    app->store.pass_start = app->frequency;
+    app->store.pass_complete = false;
+    scanner_baseline_init(
+        &app->monitor.baseline,
+        scanner_arena_alloc_block(arena, "Baseline", scanner_baseline_size(radio_scanner_app_baseline_bins(profile))),
+        radio_scanner_app_baseline_bins(profile),
+        profile->baseline_bin_shift);
+    app->monitor.baseline_valid = false;
+    app->monitor.margin = RADIO_SCANNER_DEFAULT_MARGIN;
+    app->monitor.passes = 0;
+    app->monitor.pass_start = app->frequency;
+    app->monitor.alerts = 0;
+    app->carrier_sense.enabled = false;
+    app->carrier_sense.armed = false;
+    app->carrier_sense.reachable = true;
+    app->carrier_sense.latched = false;
+    app->carrier_sense.sensed_locks = 0;
+    app->carrier_sense.polled_locks = 0;
+    app->carrier_sense.unconfirmed_locks = 0;
+    app->scope.enabled = false;
+    app->scope.budget = RADIO_SCANNER_SCOPE_DEFAULT_BUDGET;
+    app->scope.center = 0;
+    app->scope.probe_us = RADIO_SCANNER_RSSI_SETTLE_US;
+    app->stream.running = false;
+
+    radio_scanner_load_state(app);
+    app->store.pass_start = app->frequency;
+
+    app->radio_thread = furi_thread_alloc_ex(
+        "RadioScannerRadio", RADIO_SCANNER_RADIO_THREAD_STACK, radio_scanner_app_radio_thread, app);
 
     scene_manager_next_scene(app->scene_manager, RadioScannerSceneScanner);
 
@@ -97,6 +270,10 @@ void radio_scanner_app_free(RadioScannerApp* app) {
 #ifdef FURI_DEBUG
     FURI_LOG_D(TAG, "Enter radio_scanner_app_free");
 #endif
+    furi_thread_free(app->radio_thread);
+
+    radio_scanner_save_state(app);
+
     if(app->speaker_acquired && furi_hal_speaker_is_mine()) {
         subghz_devices_set_async_mirror_pin(app->radio_device, NULL);
         furi_hal_speaker_release();
@@ -107,11 +284,15 @@ void radio_scanner_app_free(RadioScannerApp* app) {
     }
 
     if(app->radio_device) {
-        subghz_devices_flush_rx(app->radio_device);
-        subghz_devices_stop_async_rx(app->radio_device);
+        radio_scanner_carrier_sense_disarm(app);
+        // Reception only runs once the UI thread handled ScannerEventRadioReady
+        if(app->radio_ready && !app->power.asleep) {
+            subghz_devices_flush_rx(app->radio_device);
+            subghz_devices_stop_async_rx(app->radio_device);
 #ifdef FURI_DEBUG
-        FURI_LOG_D(TAG, "Asynchronous RX stopped");
+            FURI_LOG_D(TAG, "Asynchronous RX stopped");
 #endif
+        }
         subghz_devices_idle(app->radio_device);
         subghz_devices_sleep(app->radio_device);
         subghz_devices_end(app->radio_device);
@@ -122,9 +303,29 @@ void radio_scanner_app_free(RadioScannerApp* app) {
 
     subghz_devices_deinit();
 
+    // Stream
+    scanner_stream_stop(&app->stream);
+
     // Scanner
     view_dispatcher_remove_view(app->view_dispatcher, RadioScannerViewScanner);
     scanner_view_free(app->scanner);
+    furi_string_free(app->frequency_str);
+    furi_string_free(app->rssi_str);
+    furi_string_free(app->sensitivity_str);
+    furi_string_free(app->scanning_str);
+    furi_string_free(app->power_str);
+
+    // Settings
+    view_dispatcher_remove_view(app->view_dispatcher, RadioScannerViewVariableItemList);
+    variable_item_list_free(app->variable_item_list);
+
+    // Results
+    view_dispatcher_remove_view(app->view_dispatcher, RadioScannerViewSubmenu);
+    submenu_free(app->submenu);
+
+    // Memory
+    view_dispatcher_remove_view(app->view_dispatcher, RadioScannerViewWidget);
+    widget_free(app->widget);
 
     // ViewDispatcher
     view_dispatcher_free(app->view_dispatcher);
@@ -132,9 +333,14 @@ void radio_scanner_app_free(RadioScannerApp* app) {
     // SceneManager
     scene_manager_free(app->scene_manager);
 
+    furi_record_close(RECORD_NOTIFICATION);
     furi_record_close(RECORD_GUI);
 
-    free(app);
+    // Trace
+    scanner_trace_deinit();
+
+    // Arena, releases the app state and every buffer carved from it
+    scanner_arena_free(app->arena);
 #ifdef FURI_DEBUG
     FURI_LOG_D(TAG, "RadioScannerApp memory freed");
 #endif
@@ -154,20 +360,18 @@ int32_t radio_scanner_app(void* p) {
         return 1;
     }
 
-    if(!radio_scanner_init_subghz(app)) {
-        FURI_LOG_E(TAG, "Failed to initialize SubGHz");
-        radio_scanner_app_free(app);
-        return 255;
-    }
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "SubGHz initialized successfully");
-#endif
+    // Show the UI right away, the radio comes up in the background
+    furi_thread_start(app->radio_thread);
 
     view_dispatcher_run(app->view_dispatcher);
 
+    // Radio bring-up may still be running when the user leaves early
+    furi_thread_join(app->radio_thread);
+    int32_t result = furi_thread_get_return_code(app->radio_thread);
+
     radio_scanner_app_free(app);
 #ifdef FURI_DEBUG
     FURI_LOG_D(TAG, "Exit radio_scanner_app");
 #endif
-    return 0;
+    return result;
 }
@@ -1,5 +1,12 @@
 #include "radio_scanner_app_i.h"
 
+#include "helpers/scanner_trace.h"
+
+#include <cc1101_regs.h>
+#include <furi_hal_cortex.h>
+#include <furi_hal_power.h>
+#include <toolbox/saved_struct.h>
+
 /**
  * RX callback triggered on radio packet reception.
  * Currently unused beyond debug logging.
@@ -16,29 +23,29 @@ void radio_scanner_rx_callback(const void* data, size_t size, void* context) {
 
 /**
  * Updates the RSSI (signal strength) value from the radio device.
+ * The reading is also streamed over USB when streaming is enabled.
  */
 void radio_scanner_update_rssi(RadioScannerApp* app) {
     furi_assert(app);
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Enter radio_scanner_update_rssi");
-#endif
     if(app->radio_device) {
         app->rssi = subghz_devices_get_rssi(app->radio_device);
-#ifdef FURI_DEBUG
-        FURI_LOG_D(TAG, "Updated RSSI: %f", (double)app->rssi);
-#endif
+        if(!app->first_rssi_ms) {
+            app->first_rssi_ms = (furi_get_tick() - app->startup_tick) * 1000 / furi_kernel_get_tick_frequency();
+            FURI_LOG_I(TAG, "First RSSI reading after %lu ms", app->first_rssi_ms);
+        }
+        scanner_trace_record(ScannerTraceEventRssi, scanner_trace_rssi(app->rssi), app->frequency);
+        scanner_stream_push_step(&app->stream, app->frequency, app->rssi);
     } else {
         FURI_LOG_E(TAG, "Radio device is NULL");
         app->rssi = RADIO_SCANNER_DEFAULT_RSSI;
     }
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Exit radio_scanner_update_rssi");
-#endif
 }
 
 /**
- * Initializes the SubGHz radio device with appropriate settings.
- * Sets frequency, loads preset, and begins asynchronous reception.
+ * Initializes the SubGHz radio device and loads the preset.
+ * Runs on the radio bring-up thread and only touches the device: the device is published
+ * in radio_device, which the UI thread reads once ScannerEventRadioReady arrives.
+ * Reception is started later from the UI thread by radio_scanner_start_rx.
  */
 bool radio_scanner_init_subghz(RadioScannerApp* app) {
     furi_assert(app);
@@ -57,35 +64,53 @@ bool radio_scanner_init_subghz(RadioScannerApp* app) {
     }
     FURI_LOG_I(TAG, "SubGhzDevice obtained: %s", subghz_devices_get_name(device));
 
-    app->radio_device = device;
-
     subghz_devices_begin(device);
     subghz_devices_reset(device);
 #ifdef FURI_DEBUG
     FURI_LOG_D(TAG, "SubGhzDevice begun");
-#endif
-    if(!subghz_devices_is_frequency_valid(device, app->frequency)) {
-        FURI_LOG_E(TAG, "Invalid frequency: %lu", app->frequency);
-        return false;
-    }
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Frequency is valid: %lu", app->frequency);
 #endif
     subghz_devices_load_preset(device, FuriHalSubGhzPreset2FSKDev238Async, NULL);
 #ifdef FURI_DEBUG
     FURI_LOG_D(TAG, "Preset loaded");
 #endif
-    subghz_devices_set_frequency(device, app->frequency);
+    app->radio_device = device;
+#ifdef FURI_DEBUG
+    FURI_LOG_D(TAG, "Exit radio_scanner_init_subghz");
+#endif
+    return true;
+}
+
+/**
+ * Tunes the freshly initialized device and begins asynchronous reception.
+ * Runs on the UI thread when ScannerEventRadioReady arrives, so the frequency is
+ * validated where it is also read and written by the scenes.
+ */
+void radio_scanner_start_rx(RadioScannerApp* app) {
+    furi_assert(app);
+    if(!subghz_devices_is_frequency_valid(app->radio_device, app->frequency)) {
+        // A stale state file must not prevent the app from starting
+        FURI_LOG_W(TAG, "Invalid frequency: %lu, using default", app->frequency);
+        app->frequency = RADIO_SCANNER_DEFAULT_FREQ;
+    }
+    subghz_devices_set_frequency(app->radio_device, app->frequency);
 #ifdef FURI_DEBUG
     FURI_LOG_D(TAG, "Frequency set to %lu", app->frequency);
 #endif
-    subghz_devices_start_async_rx(device, radio_scanner_rx_callback, app);
+    subghz_devices_start_async_rx(app->radio_device, radio_scanner_rx_callback, app);
 #ifdef FURI_DEBUG
     FURI_LOG_D(TAG, "Asynchronous RX started");
 #endif
+}
+
+/**
+ * Acquires the speaker and mirrors the demodulated signal to it.
+ * Must run on the UI thread, which also releases the speaker on exit.
+ */
+void radio_scanner_acquire_speaker(RadioScannerApp* app) {
+    furi_assert(app);
     if(furi_hal_speaker_acquire(30)) {
         app->speaker_acquired = true;
-        subghz_devices_set_async_mirror_pin(device, &gpio_speaker);
+        subghz_devices_set_async_mirror_pin(app->radio_device, &gpio_speaker);
 #ifdef FURI_DEBUG
         FURI_LOG_D(TAG, "Speaker acquired and async mirror pin set");
 #endif
@@ -93,52 +118,341 @@ bool radio_scanner_init_subghz(RadioScannerApp* app) {
         app->speaker_acquired = false;
         FURI_LOG_E(TAG, "Failed to acquire speaker");
     }
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Exit radio_scanner_init_subghz");
-#endif
-    return true;
 }
 
 /**
- * Core logic for scanning radio frequencies.
- * Adjusts frequency up/down and checks for valid signal above sensitivity threshold.
+ * Snaps a frequency to the nearest channel of the step grid.
  */
-void radio_scanner_process_scanning(RadioScannerApp* app) {
+static uint32_t radio_scanner_snap_frequency(uint32_t frequency) {
+    return (frequency + SUBGHZ_FREQUENCY_STEP / 2) / SUBGHZ_FREQUENCY_STEP * SUBGHZ_FREQUENCY_STEP;
+}
+
+/**
+ * Restores the last frequency, direction, sensitivity and scanning state from the state file.
+ * Keeps the defaults when the file is missing or from another version. The frequency is
+ * snapped to the step grid and only kept when it lies in one of the device bands.
+ */
+void radio_scanner_load_state(RadioScannerApp* app) {
     furi_assert(app);
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Enter radio_scanner_process_scanning");
-#endif
-    radio_scanner_update_rssi(app);
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "RSSI after update: %f", (double)app->rssi);
-#endif
-    bool signal_detected = (app->rssi > app->sensitivity);
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Signal detected: %d", signal_detected);
-#endif
+    RadioScannerState state;
+    if(!saved_struct_load(
+           RADIO_SCANNER_STATE_PATH,
+           &state,
+           sizeof(state),
+           RADIO_SCANNER_STATE_MAGIC,
+           RADIO_SCANNER_STATE_VERSION)) {
+        FURI_LOG_I(TAG, "No saved state");
+        return;
+    }
+    uint32_t frequency = radio_scanner_snap_frequency(state.frequency);
+    if((frequency >= SUBGHZ_FREQUENCY_MIN && frequency <= 348000000) ||
+       (frequency >= 387000000 && frequency <= 464000000) ||
+       (frequency >= 779000000 && frequency <= SUBGHZ_FREQUENCY_MAX)) {
+        app->frequency = frequency;
+    }
+    app->sensitivity = state.sensitivity;
+    app->scan_direction = state.scan_direction == ScanDirectionDown ? ScanDirectionDown : ScanDirectionUp;
+    app->scanning = state.scanning;
+    FURI_LOG_I(TAG, "Resuming at %lu", app->frequency);
+}
 
-    if(signal_detected) {
-        if(app->scanning) {
-            app->scanning = false;
-#ifdef FURI_DEBUG
-            FURI_LOG_D(TAG, "Scanning stopped");
-#endif
-        }
+/**
+ * Saves the current frequency, direction, sensitivity and scanning state to the state file.
+ */
+void radio_scanner_save_state(RadioScannerApp* app) {
+    furi_assert(app);
+    RadioScannerState state = {
+        .frequency = app->frequency,
+        .sensitivity = app->sensitivity,
+        .scan_direction = app->scan_direction,
+        .scanning = app->scanning,
+    };
+    if(!saved_struct_save(
+           RADIO_SCANNER_STATE_PATH,
+           &state,
+           sizeof(state),
+           RADIO_SCANNER_STATE_MAGIC,
+           RADIO_SCANNER_STATE_VERSION)) {
+        FURI_LOG_E(TAG, "Failed to save state");
+    }
+}
+
+/**
+ * Retunes the radio device to the given frequency and restarts asynchronous reception.
+ * Returns the frequency actually synthesized by the device.
+ */
+uint32_t radio_scanner_tune(RadioScannerApp* app, uint32_t frequency) {
+    furi_assert(app);
+    uint32_t real_frequency;
+    if(app->carrier_sense.armed) {
+        // IDLE clears the carrier sense output, the latch then only covers the new channel
+        subghz_devices_idle(app->radio_device);
+        real_frequency = subghz_devices_set_frequency(app->radio_device, frequency);
+        app->carrier_sense.latched = false;
+        subghz_devices_set_rx(app->radio_device);
     } else {
-        if(!app->scanning) {
-            app->scanning = true;
-#ifdef FURI_DEBUG
-            FURI_LOG_D(TAG, "Scanning started");
-#endif
-        }
+        subghz_devices_flush_rx(app->radio_device);
+        subghz_devices_stop_async_rx(app->radio_device);
+        subghz_devices_idle(app->radio_device);
+        real_frequency = subghz_devices_set_frequency(app->radio_device, frequency);
+        subghz_devices_start_async_rx(app->radio_device, radio_scanner_rx_callback, app);
     }
+    scanner_trace_record(ScannerTraceEventTune, 0, real_frequency);
+    return real_frequency;
+}
 
-    if(!app->scanning) {
-#ifdef FURI_DEBUG
-        FURI_LOG_D(TAG, "Exit radio_scanner_process_scanning");
+/**
+ * Carrier sense preset registers, without the AGC threshold registers.
+ * OOK with a 650 kHz receive filter so a carrier anywhere in the step is sensed.
+ */
+static const uint8_t radio_scanner_carrier_sense_regs[] = {
+    CC1101_IOCFG0, 0x0E, // GDO0 high while the RSSI is above the carrier sense threshold
+    CC1101_FIFOTHR, 0x47, // ADC retention
+    CC1101_PKTCTRL0, 0x32, // Asynchronous serial mode, infinite packet length
+    CC1101_FSCTRL1, 0x06, // IF 152 kHz
+    CC1101_MDMCFG4, 0x17, // RX filter bandwidth 650 kHz
+    CC1101_MDMCFG3, 0x32,
+    CC1101_MDMCFG2, 0x30, // ASK/OOK, no preamble or sync word
+    CC1101_MDMCFG1, 0x00,
+    CC1101_MDMCFG0, 0x00,
+    CC1101_MCSM0, 0x18, // Calibrate when going from IDLE to RX
+    CC1101_FOCCFG, 0x18, // No frequency offset compensation
+    CC1101_AGCCTRL0, 0x91, // Medium hysteresis, 16 samples
+    CC1101_WORCTRL, 0xFB,
+    CC1101_FREND1, 0xB6,
+    CC1101_FREND0, 0x11,
+};
+
+/**
+ * Gain reduction of each MAX_LNA_GAIN setting below the maximum LNA gain, in dB.
+ */
+static const uint8_t radio_scanner_carrier_sense_lna_db[] = {0, 3, 6, 7, 9, 12, 15, 17};
+
+/**
+ * Builds the carrier sense preset with its threshold programmed from the sensitivity.
+ * The threshold is set coarsely by reducing the DVGA gain in 6 dB steps, then by reducing
+ * the LNA gain (up to 17 dB), then finely by the absolute carrier sense threshold (-7 to +7 dB).
+ * Levels are relative to the typical threshold at full gain with a 33 dB magnitude target,
+ * RADIO_SCANNER_CS_FLOOR_DBM.
+ * Returns false when the sensitivity is above RADIO_SCANNER_CS_CEIL_DBM: the radio would then
+ * sense signals below the sensitivity.
+ */
+static bool radio_scanner_carrier_sense_build_preset(RadioScannerCarrierSense* carrier_sense, float sensitivity) {
+    if(sensitivity > (float)RADIO_SCANNER_CS_CEIL_DBM) {
+        return false;
+    }
+    int32_t level = (int32_t)(sensitivity - (float)RADIO_SCANNER_CS_FLOOR_DBM);
+    int32_t dvga_reduction = CLAMP((level + 3) / 6, 3, 0);
+    level -= dvga_reduction * 6;
+    uint8_t lna_reduction = 0;
+    while(level - radio_scanner_carrier_sense_lna_db[lna_reduction] > 7) {
+        lna_reduction++;
+    }
+    int32_t threshold = CLAMP(level - radio_scanner_carrier_sense_lna_db[lna_reduction], 7, -7);
+
+    size_t size = sizeof(radio_scanner_carrier_sense_regs);
+    furi_check(size + 4 + 2 + 8 <= RADIO_SCANNER_CS_PRESET_SZ);
+    memcpy(carrier_sense->preset, radio_scanner_carrier_sense_regs, size);
+    carrier_sense->preset[size++] = CC1101_AGCCTRL2;
+    carrier_sense->preset[size++] =
+        (uint8_t)(dvga_reduction << 6) | (uint8_t)(lna_reduction << 3) | 0x03; // 33 dB target
+    carrier_sense->preset[size++] = CC1101_AGCCTRL1;
+    carrier_sense->preset[size++] = 0x40 | (uint8_t)(threshold & 0x0F); // Relative threshold disabled
+    // End of registers, then the PA table which is unused in receive only
+    memset(&carrier_sense->preset[size], 0, 2 + 8);
+    return true;
+}
+
+/**
+ * GDO0 rising edge interrupt: latches energy on the current channel.
+ */
+static void radio_scanner_carrier_sense_callback(void* context) {
+    RadioScannerApp* app = context;
+    if(!app->carrier_sense.latched) {
+        app->carrier_sense.latched = true;
+        scanner_trace_record(ScannerTraceEventCarrierSense, 0, app->frequency);
+    }
+}
+
+/**
+ * Switches the radio to the carrier sense preset and enables the GDO0 interrupt.
+ * Reprograms the threshold when the sensitivity changed since the radio was armed.
+ * A sensitivity the threshold cannot follow leaves carrier sense disarmed, detection then
+ * falls back to RSSI polling until the sensitivity changes.
+ */
+static void radio_scanner_carrier_sense_arm(RadioScannerApp* app) {
+    RadioScannerCarrierSense* carrier_sense = &app->carrier_sense;
+    if(carrier_sense->sensitivity == app->sensitivity && (carrier_sense->armed || !carrier_sense->reachable)) {
         return;
-#endif
     }
+    carrier_sense->sensitivity = app->sensitivity;
+    carrier_sense->reachable = radio_scanner_carrier_sense_build_preset(carrier_sense, app->sensitivity);
+    if(!carrier_sense->reachable) {
+        FURI_LOG_W(TAG, "Carrier sense threshold out of range, polling only");
+        radio_scanner_carrier_sense_disarm(app);
+        return;
+    }
+    if(!carrier_sense->armed) {
+        subghz_devices_flush_rx(app->radio_device);
+        subghz_devices_stop_async_rx(app->radio_device);
+    }
+    subghz_devices_idle(app->radio_device);
+    subghz_devices_load_preset(app->radio_device, FuriHalSubGhzPresetCustom, carrier_sense->preset);
+    if(!carrier_sense->armed) {
+        const GpioPin* pin = subghz_devices_get_data_gpio(app->radio_device);
+        furi_hal_gpio_init(pin, GpioModeInterruptRise, GpioPullNo, GpioSpeedLow);
+        furi_hal_gpio_add_int_callback(pin, radio_scanner_carrier_sense_callback, app);
+        carrier_sense->armed = true;
+    }
+    radio_scanner_tune(app, app->frequency);
+    // The sweep reads the RSSI right after
+    furi_delay_us(RADIO_SCANNER_RSSI_SETTLE_US);
+}
+
+/**
+ * Disables the GDO0 interrupt and restores the audio preset and asynchronous reception.
+ * Does nothing when carrier sense is not armed.
+ */
+void radio_scanner_carrier_sense_disarm(RadioScannerApp* app) {
+    furi_assert(app);
+    RadioScannerCarrierSense* carrier_sense = &app->carrier_sense;
+    if(!carrier_sense->armed) {
+        return;
+    }
+    furi_hal_gpio_remove_int_callback(subghz_devices_get_data_gpio(app->radio_device));
+    carrier_sense->armed = false;
+    carrier_sense->latched = false;
+    subghz_devices_idle(app->radio_device);
+    subghz_devices_load_preset(app->radio_device, FuriHalSubGhzPreset2FSKDev238Async, NULL);
+    radio_scanner_tune(app, app->frequency);
+    furi_delay_us(RADIO_SCANNER_RSSI_SETTLE_US);
+}
+
+/**
+ * Counts a lock taken while carrier sense was armed, once the lock has been centered.
+ * A lock raised by carrier sense alone only counts as a catch when the reading at the
+ * centered frequency confirms a signal above the sensitivity.
+ */
+static void radio_scanner_carrier_sense_count_lock(RadioScannerApp* app, bool polled) {
+    RadioScannerCarrierSense* carrier_sense = &app->carrier_sense;
+    RadioScannerCarrierSenseLock kind;
+    if(polled) {
+        carrier_sense->polled_locks++;
+        kind = RadioScannerCarrierSenseLockPolled;
+    } else if(app->rssi > app->sensitivity) {
+        carrier_sense->sensed_locks++;
+        kind = RadioScannerCarrierSenseLockSensed;
+    } else {
+        carrier_sense->unconfirmed_locks++;
+        kind = RadioScannerCarrierSenseLockUnconfirmed;
+    }
+    scanner_trace_record(ScannerTraceEventCarrierSenseLock, kind, app->frequency);
+}
+
+/**
+ * Arms carrier sense while a search sweep runs and disarms it otherwise.
+ * Other modes and a held lock need the asynchronous reception.
+ */
+void radio_scanner_carrier_sense_update(RadioScannerApp* app) {
+    furi_assert(app);
+    if(app->carrier_sense.enabled && app->scanning && app->scan_mode == ScanModeSearch) {
+        radio_scanner_carrier_sense_arm(app);
+    } else {
+        radio_scanner_carrier_sense_disarm(app);
+    }
+}
+
+/**
+ * Tunes to the given frequency and reads the RSSI once it has settled.
+ * Frequencies outside the device bands read as the default (noise floor) RSSI.
+ */
+static float radio_scanner_probe_rssi(RadioScannerApp* app, uint32_t frequency) {
+    if(!subghz_devices_is_frequency_valid(app->radio_device, frequency)) {
+        return RADIO_SCANNER_DEFAULT_RSSI;
+    }
+    radio_scanner_tune(app, frequency);
+    furi_delay_us(RADIO_SCANNER_RSSI_SETTLE_US);
+    float rssi = subghz_devices_get_rssi(app->radio_device);
+    scanner_trace_record(ScannerTraceEventRssi, scanner_trace_rssi(rssi), frequency);
+    return rssi;
+}
+
+/**
+ * Refines a fresh lock towards the carrier peak with a coarse-to-fine search.
+ * The RSSI is measured through the ~270 kHz receive filter, so the first level probes
+ * RADIO_SCANNER_PEAK_COARSE_STEP either side to get off the skirt of the signal. Each level
+ * re-reads the center, climbs towards a neighbour at least RADIO_SCANNER_PEAK_MIN_GAIN_DB
+ * stronger for up to RADIO_SCANNER_PEAK_MAX_CLIMBS steps, then divides the step until
+ * RADIO_SCANNER_PEAK_FINE_STEP. A parabola through the last three readings gives the peak.
+ * The lock point is kept when the center falls below the sensitivity, as the signal is gone.
+ * The grid channel of the lock is kept in lock_frequency so the sweep resumes on the grid.
+ */
+void radio_scanner_center_on_peak(RadioScannerApp* app) {
+    furi_assert(app);
+    app->lock_frequency = radio_scanner_snap_frequency(app->frequency);
+    uint32_t lock = app->frequency;
+    uint32_t center = lock;
+    uint32_t step = RADIO_SCANNER_PEAK_COARSE_STEP;
+    float rssi_center;
+    float rssi_low;
+    float rssi_high;
+    uint8_t retunes = 0;
+
+    while(true) {
+        rssi_center = radio_scanner_probe_rssi(app, center);
+        retunes++;
+        if(rssi_center <= app->sensitivity) {
+            // Every further decision would follow noise
+            center = lock;
+            break;
+        }
+        rssi_low = radio_scanner_probe_rssi(app, center - step);
+        rssi_high = radio_scanner_probe_rssi(app, center + step);
+        retunes += 2;
+        for(uint8_t climbs = 0; climbs < RADIO_SCANNER_PEAK_MAX_CLIMBS; climbs++) {
+            if(rssi_high >= rssi_center + RADIO_SCANNER_PEAK_MIN_GAIN_DB && rssi_high >= rssi_low) {
+                rssi_low = rssi_center;
+                rssi_center = rssi_high;
+                center += step;
+                rssi_high = radio_scanner_probe_rssi(app, center + step);
+            } else if(rssi_low >= rssi_center + RADIO_SCANNER_PEAK_MIN_GAIN_DB) {
+                rssi_high = rssi_center;
+                rssi_center = rssi_low;
+                center -= step;
+                rssi_low = radio_scanner_probe_rssi(app, center - step);
+            } else {
+                break;
+            }
+            retunes++;
+        }
+        if(step <= RADIO_SCANNER_PEAK_FINE_STEP) {
+            // Vertex of the parabola through (-step, low), (0, center), (+step, high)
+            float offset = 0.0f;
+            float curvature = rssi_low - 2.0f * rssi_center + rssi_high;
+            if(curvature < 0.0f) {
+                offset = 0.5f * (rssi_low - rssi_high) / curvature * (float)step;
+                offset = CLAMP(offset, (float)step, -(float)step);
+            }
+            uint32_t vertex = (uint32_t)((int32_t)center + (int32_t)offset);
+            if(subghz_devices_is_frequency_valid(app->radio_device, vertex)) {
+                center = vertex;
+            }
+            break;
+        }
+        step /= RADIO_SCANNER_PEAK_STEP_DIVIDER;
+    }
+
+    app->frequency = radio_scanner_tune(app, center);
+    furi_delay_us(RADIO_SCANNER_RSSI_SETTLE_US);
+    app->rssi = subghz_devices_get_rssi(app->radio_device);
+    scanner_trace_record(ScannerTraceEventPeakCentered, retunes + 1, app->frequency);
+}
+
+/**
+ * Computes the next frequency of the sweep in the scan direction.
+ * Steps over the gaps between the device bands and wraps around at the band edges.
+ */
+static uint32_t radio_scanner_next_frequency(RadioScannerApp* app) {
     uint32_t new_frequency = (app->scan_direction == ScanDirectionUp) ?
                                  app->frequency + SUBGHZ_FREQUENCY_STEP :
                                  app->frequency - SUBGHZ_FREQUENCY_STEP;
@@ -161,41 +475,525 @@ void radio_scanner_process_scanning(RadioScannerApp* app) {
                 new_frequency = SUBGHZ_FREQUENCY_MAX;
             }
         }
-#ifdef FURI_DEBUG
-        FURI_LOG_D(TAG, "Adjusted frequency to next valid range: %lu", new_frequency);
-#endif
     }
+    return new_frequency;
+}
+
+/**
+ * Alerts on a signal that deviates from the baseline.
+ */
+static void radio_scanner_monitor_alert(RadioScannerApp* app) {
+    static const NotificationSequence sequence_alert = {
+        &message_vibro_on,
+        &message_red_255,
+        &message_delay_100,
+        &message_vibro_off,
+        &message_red_0,
+        NULL,
+    };
+    app->monitor.alerts++;
+    notification_message(app->notifications, &sequence_alert);
+    scanner_trace_record(ScannerTraceEventBaselineAlert, scanner_trace_rssi(app->rssi), app->frequency);
+}
+
+/**
+ * Moves the search sweep to its next channel.
+ * After a lock the sweep continues from the grid channel the lock was found on.
+ * The weighted sweep holds each channel for the dwell of its segment, one RSSI read per
+ * tick, so it costs the same per tick as the linear sweep.
+ */
+static void radio_scanner_advance(RadioScannerApp* app) {
+    if(app->lock_frequency) {
+        // Resume from the grid channel of the lock, not from the refined peak
+        app->frequency = app->lock_frequency;
+        app->lock_frequency = 0;
+    }
+    if(app->scan_sweep == ScanSweepWeighted) {
+        if(app->schedule_dwell > 1) {
+            app->schedule_dwell--;
+            return;
+        }
+        uint8_t segment = scanner_schedule_next(
+            &app->schedule, app->scan_direction == ScanDirectionUp, SUBGHZ_FREQUENCY_STEP, &app->frequency);
+        app->schedule_dwell = app->schedule.segments[segment].dwell;
+    } else {
+        app->frequency = radio_scanner_next_frequency(app);
+    }
+    // Keep the requested frequency so the sweep stays on the step grid
+    radio_scanner_tune(app, app->frequency);
+}
+
+/**
+ * Core logic for scanning radio frequencies.
+ * Adjusts frequency up/down and checks for valid signal above sensitivity threshold,
+ * or for energy latched by carrier sense since the channel was tuned.
+ * A fresh lock is refined onto the carrier peak before scanning stops.
+ */
+void radio_scanner_process_scanning(RadioScannerApp* app) {
+    furi_assert(app);
+    radio_scanner_update_rssi(app);
+    bool signal_detected = (app->rssi > app->sensitivity);
+    if(signal_detected && app->scan_mode == ScanModeMonitor) {
+        signal_detected = scanner_baseline_exceeds(
+            &app->monitor.baseline,
+            radio_scanner_channel_index(app->frequency),
+            app->rssi,
+            app->monitor.margin);
+    }
+
+    bool sensed = app->carrier_sense.armed && app->carrier_sense.latched;
+
+    if(signal_detected || sensed) {
+        if(app->scanning) {
+            app->scanning = false;
+            app->schedule_dwell = 0;
+            bool carrier_sense_lock = app->carrier_sense.armed;
+            if(carrier_sense_lock) {
+                // Listen to the lock with the audio preset
+                radio_scanner_carrier_sense_disarm(app);
+            }
+            scanner_trace_record(ScannerTraceEventLock, scanner_trace_rssi(app->rssi), app->frequency);
+            scanner_schedule_report_hit(&app->schedule, app->frequency);
+            radio_scanner_center_on_peak(app);
+            if(carrier_sense_lock) {
+                radio_scanner_carrier_sense_count_lock(app, signal_detected);
+            }
+            scanner_stream_push_lock(&app->stream, app->frequency, app->rssi);
+            if(app->scan_mode == ScanModeMonitor) {
+                radio_scanner_monitor_alert(app);
+            }
+        }
+    } else {
+        if(!app->scanning) {
+            app->scanning = true;
+            scanner_trace_record(ScannerTraceEventUnlock, 0, app->frequency);
+        }
+    }
+
+    if(!app->scanning) {
+        return;
+    }
+    radio_scanner_advance(app);
+}
+
+/**
+ * Clears the band scope and centers it on the current frequency.
+ */
+static void radio_scanner_scope_reset(RadioScannerApp* app) {
+    RadioScannerScope* scope = &app->scope;
+    scope->center = app->frequency;
+    scope->position = 0;
+    scope->credit_us = 0;
+    memset(scope->levels, (int8_t)RADIO_SCANNER_DEFAULT_RSSI, sizeof(scope->levels));
+}
+
+/**
+ * Runs one slice of the band scope while locked.
+ * Probes as many neighbouring channels as the accumulated credit pays for, keeping one
+ * probe in reserve for the tune back to the lock, then charges the measured time.
+ * The cost estimate follows the last slice so slow retunes shrink the next one.
+ */
+void radio_scanner_process_scope(RadioScannerApp* app) {
+    furi_assert(app);
+    RadioScannerScope* scope = &app->scope;
+    if(!scope->enabled) {
+        return;
+    }
+    if(scope->center != app->frequency) {
+        radio_scanner_scope_reset(app);
+    }
+    scope->levels[RADIO_SCANNER_SCOPE_HALF_SPAN] = (int8_t)CLAMP(app->rssi, 127.0f, -128.0f);
+
+    int32_t tick_credit_us = scope->budget * RADIO_SCANNER_TICK_PERIOD_MS * 10;
+    scope->credit_us = MIN(scope->credit_us + tick_credit_us, 2 * tick_credit_us);
+    int32_t probes = scope->credit_us / (int32_t)scope->probe_us - 1;
+    probes = MIN(probes, RADIO_SCANNER_SCOPE_BINS - 1);
+    if(probes < 1) {
+        return;
+    }
+
+    uint32_t start = DWT->CYCCNT;
+    for(int32_t i = 0; i < probes; i++) {
+        if(scope->position == RADIO_SCANNER_SCOPE_HALF_SPAN) {
+            scope->position++;
+        }
+        uint32_t frequency = scope->center +
+                             ((int32_t)scope->position - RADIO_SCANNER_SCOPE_HALF_SPAN) * SUBGHZ_FREQUENCY_STEP;
+        float rssi = radio_scanner_probe_rssi(app, frequency);
+        scope->levels[scope->position] = (int8_t)CLAMP(rssi, 127.0f, -128.0f);
+        scope->position = (scope->position + 1) % RADIO_SCANNER_SCOPE_BINS;
+    }
+    radio_scanner_tune(app, scope->center);
+    furi_delay_us(RADIO_SCANNER_RSSI_SETTLE_US);
+
+    uint32_t elapsed_us = (DWT->CYCCNT - start) / furi_hal_cortex_instructions_per_microsecond();
+    scope->credit_us -= (int32_t)elapsed_us;
+    scope->probe_us = MAX(elapsed_us / (uint32_t)(probes + 1), (uint32_t)1);
+    scanner_trace_record(ScannerTraceEventScopeSlice, probes, elapsed_us);
+}
+
+/**
+ * Consumes the RSSI of the current channel during a full sweep pass.
+ */
+typedef void (*RadioScannerPassSample)(RadioScannerApp* app);
+
+/**
+ * Starts a full sweep pass from the current frequency and returns its start.
+ * The start is always snapped to the step grid, even before the radio is ready,
+ * so the sweep lands on it again after a full pass.
+ */
+static uint32_t radio_scanner_pass_begin(RadioScannerApp* app) {
+    app->frequency = radio_scanner_snap_frequency(app->frequency);
+    app->lock_frequency = 0;
+    if(app->radio_ready) {
+        radio_scanner_tune(app, app->frequency);
+    }
+    return app->frequency;
+}
+
+/**
+ * Sweeps up to RADIO_SCANNER_PASS_STEPS_PER_TICK channels without stopping,
+ * handing the RSSI of every channel to the sample callback.
+ * Returns true once the sweep is back at the pass start.
+ */
+static bool radio_scanner_pass_step(RadioScannerApp* app, uint32_t pass_start, RadioScannerPassSample sample) {
+    for(uint8_t i = 0; i < RADIO_SCANNER_PASS_STEPS_PER_TICK; i++) {
+        if(i) {
+            furi_delay_us(RADIO_SCANNER_RSSI_SETTLE_US);
+        }
+        radio_scanner_update_rssi(app);
+        sample(app);
+
+        app->frequency = radio_scanner_next_frequency(app);
+        radio_scanner_tune(app, app->frequency);
+        if(app->frequency == pass_start) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Starts a new search-and-store pass from the current frequency.
+ */
+void radio_scanner_store_begin(RadioScannerApp* app) {
+    furi_assert(app);
+    RadioScannerStoreMode* store = &app->store;
+    scanner_store_reset(&store->results);
+    store->run_active = false;
+    store->pass_complete = false;
+    store->pass_start = radio_scanner_pass_begin(app);
+}
+
+/**
+ * Closes the current run of hits and stores it as one result.
+ * The hit also feeds the activity history of the weighted sweep.
+ */
+static void radio_scanner_store_close_run(RadioScannerStoreMode* store, ScannerSchedule* schedule) {
+    if(!store->run_active) {
+        return;
+    }
+    store->run_active = false;
+    store->run.bandwidth = (store->run_last > store->run_first ? store->run_last - store->run_first :
+                                                                 store->run_first - store->run_last) +
+                           SUBGHZ_FREQUENCY_STEP;
+    scanner_store_add(&store->results, &store->run);
+    scanner_schedule_report_hit(schedule, store->run.frequency);
+    scanner_trace_record(ScannerTraceEventStoreHit, scanner_trace_rssi(store->run.rssi), store->run.frequency);
+}
+
+/**
+ * Records the RSSI of the current channel into the pass.
+ * Hits on adjacent channels extend the current run, keeping its peak.
+ */
+static void radio_scanner_store_sample(RadioScannerApp* app) {
+    RadioScannerStoreMode* store = &app->store;
+    if(app->rssi <= app->sensitivity) {
+        radio_scanner_store_close_run(store, &app->schedule);
+        return;
+    }
+
+    uint32_t distance = app->frequency > store->run_last ? app->frequency - store->run_last :
+                                                           store->run_last - app->frequency;
+    if(store->run_active && distance == SUBGHZ_FREQUENCY_STEP) {
+        store->run_last = app->frequency;
+        if(app->rssi > store->run.rssi) {
+            store->run.frequency = app->frequency;
+            store->run.rssi = app->rssi;
+        }
+        return;
+    }
+
+    radio_scanner_store_close_run(store, &app->schedule);
+    store->run_active = true;
+    store->run_first = app->frequency;
+    store->run_last = app->frequency;
+    store->run.frequency = app->frequency;
+    store->run.rssi = app->rssi;
+}
+
+/**
+ * Ends the current pass: the last run is stored and scanning stops.
+ * The next scan starts a new pass.
+ */
+static void radio_scanner_store_end_pass(RadioScannerApp* app) {
+    RadioScannerStoreMode* store = &app->store;
+    radio_scanner_store_close_run(store, &app->schedule);
+    store->pass_complete = true;
+    app->scanning = false;
+    scanner_trace_record(ScannerTraceEventStorePass, store->results.count, store->pass_start);
+}
+
+/**
+ * Sweeps the next channels of the pass, recording every hit.
+ * Returns true once the pass is complete: scanning then stops and
+ * the sorted results are ready to be presented.
+ */
+bool radio_scanner_process_store(RadioScannerApp* app) {
+    furi_assert(app);
+    RadioScannerStoreMode* store = &app->store;
+    if(store->pass_complete ||
+       !radio_scanner_pass_step(app, store->pass_start, radio_scanner_store_sample)) {
+        return false;
+    }
+
+    radio_scanner_store_end_pass(app);
+    return true;
+}
+
+/**
+ * Tunes to a stored result and holds there, centered on its peak.
+ * A pass still running is ended there: centering leaves the frequency off the step grid,
+ * so resuming it would record the rest of the pass on the wrong channels.
+ */
+void radio_scanner_store_listen(RadioScannerApp* app, size_t index) {
+    furi_assert(app);
+    furi_assert(index < app->store.results.count);
+    uint32_t frequency = app->store.results.entries[index].frequency;
+    if(!app->store.pass_complete) {
+        radio_scanner_store_end_pass(app);
+    }
+    app->scanning = false;
+    app->frequency = radio_scanner_tune(app, frequency);
+    furi_delay_us(RADIO_SCANNER_RSSI_SETTLE_US);
+    radio_scanner_update_rssi(app);
+    radio_scanner_center_on_peak(app);
+}
+
+/**
+ * Maps a frequency to its index among the channels of the device bands, gaps excluded.
+ * Frequencies between channels round to the nearest one.
+ */
+size_t radio_scanner_channel_index(uint32_t frequency) {
+    size_t index;
+    if(frequency < 387000000) {
+        index = (frequency - SUBGHZ_FREQUENCY_MIN + SUBGHZ_FREQUENCY_STEP / 2) / SUBGHZ_FREQUENCY_STEP;
+    } else if(frequency < 779000000) {
+        index = (348000000 - SUBGHZ_FREQUENCY_MIN) / SUBGHZ_FREQUENCY_STEP + 1 +
+                (frequency - 387000000 + SUBGHZ_FREQUENCY_STEP / 2) / SUBGHZ_FREQUENCY_STEP;
+    } else {
+        index = (348000000 - SUBGHZ_FREQUENCY_MIN) / SUBGHZ_FREQUENCY_STEP + 1 +
+                (464000000 - 387000000) / SUBGHZ_FREQUENCY_STEP + 1 +
+                (frequency - 779000000 + SUBGHZ_FREQUENCY_STEP / 2) / SUBGHZ_FREQUENCY_STEP;
+    }
+    return MIN(index, (size_t)RADIO_SCANNER_CHANNEL_COUNT - 1);
+}
+
+/**
+ * Starts capturing a new baseline from the current frequency.
+ */
+void radio_scanner_capture_begin(RadioScannerApp* app) {
+    furi_assert(app);
+    RadioScannerMonitor* monitor = &app->monitor;
+    scanner_baseline_reset(&monitor->baseline);
+    monitor->baseline_valid = false;
+    monitor->passes = 0;
+    monitor->pass_start = radio_scanner_pass_begin(app);
+}
+
+/**
+ * Raises the baseline peak of the current channel, which counts as busy above the sensitivity.
+ */
+static void radio_scanner_capture_sample(RadioScannerApp* app) {
+    scanner_baseline_record(
+        &app->monitor.baseline,
+        radio_scanner_channel_index(app->frequency),
+        app->rssi,
+        app->rssi > app->sensitivity);
+}
+
+/**
+ * Sweeps the next channels of the pass, raising the baseline peaks and occupancy.
+ * The baseline is saved at the end of every pass and capture carries on, so
+ * further passes tell intermittent transmitters of the site from one-off ones.
+ */
+void radio_scanner_process_capture(RadioScannerApp* app) {
+    furi_assert(app);
+    RadioScannerMonitor* monitor = &app->monitor;
+    if(!radio_scanner_pass_step(app, monitor->pass_start, radio_scanner_capture_sample)) {
+        return;
+    }
+
+    scanner_baseline_end_pass(&monitor->baseline);
+    monitor->passes++;
+    monitor->baseline_valid = true;
+    if(!scanner_baseline_save(&monitor->baseline, RADIO_SCANNER_BASELINE_PATH)) {
+        FURI_LOG_E(TAG, "Failed to save baseline");
+    }
+    scanner_trace_record(ScannerTraceEventBaselinePass, monitor->passes, monitor->pass_start);
+}
+
+/**
+ * Starts monitoring against the baseline.
+ * The last captured baseline is used, or the saved one when none was captured since launch.
+ * Returns false when there is no baseline: monitoring would then alert on every signal.
+ */
+bool radio_scanner_monitor_begin(RadioScannerApp* app) {
+    furi_assert(app);
+    RadioScannerMonitor* monitor = &app->monitor;
+    monitor->alerts = 0;
+    if(!monitor->baseline_valid) {
+        monitor->baseline_valid = scanner_baseline_load(&monitor->baseline, RADIO_SCANNER_BASELINE_PATH);
+        if(!monitor->baseline_valid) {
+            FURI_LOG_W(TAG, "No baseline for this memory profile");
+        }
+    }
+    return monitor->baseline_valid;
+}
+
+/**
+ * Adds the time spent in the current power phase to the active or sleep total.
+ */
+static void radio_scanner_power_account(RadioScannerPower* power) {
+    uint32_t now = furi_get_tick();
+    uint32_t elapsed_ms = (now - power->phase_start) * 1000 / furi_kernel_get_tick_frequency();
+    if(power->asleep) {
+        power->sleep_ms += elapsed_ms;
+    } else {
+        power->active_ms += elapsed_ms;
+    }
+    power->phase_start = now;
+}
+
+/**
+ * Samples the fuel gauge current at the end of the current power phase and updates the
+ * remaining battery life estimate. The gauge averages over about a second, so each reading
+ * stands for the phase it ends; the two are weighted by the measured active/sleep ratio.
+ */
+static void radio_scanner_power_update_battery(RadioScannerPower* power) {
+    float current = furi_hal_power_get_battery_current(FuriHalPowerICFuelGauge);
+    if(power->asleep) {
+        power->sleep_current = current;
+    } else {
+        power->active_current = current;
+    }
+
+    uint32_t total_ms = power->active_ms + power->sleep_ms;
+    if(power->active_current >= 0.0f || power->sleep_current >= 0.0f || total_ms == 0) {
+        // Charging or a phase not measured yet
+        power->battery_hours = 0;
+        return;
+    }
+    float average = (power->active_current * (float)power->active_ms +
+                     power->sleep_current * (float)power->sleep_ms) /
+                    (float)total_ms;
+    uint32_t capacity_mah = furi_hal_power_get_battery_remaining_capacity();
+    power->battery_hours = (uint32_t)((float)capacity_mah / (-average * 1000.0f));
+}
+
+/**
+ * Ends the current sweep burst: puts the radio to sleep and stretches the tick
+ * period so the MCU stays idle until the next burst or an input event.
+ */
+static void radio_scanner_power_sleep(RadioScannerApp* app) {
+    RadioScannerPower* power = &app->power;
+    radio_scanner_power_account(power);
+    radio_scanner_power_update_battery(power);
+    radio_scanner_carrier_sense_disarm(app);
 
     subghz_devices_flush_rx(app->radio_device);
     subghz_devices_stop_async_rx(app->radio_device);
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Asynchronous RX stopped");
-#endif
+    subghz_devices_idle(app->radio_device);
+    subghz_devices_sleep(app->radio_device);
+    power->asleep = true;
+
+    uint32_t sleep_ms = RADIO_SCANNER_POWER_BURST_TICKS * RADIO_SCANNER_TICK_PERIOD_MS *
+                        (100 - power->duty_cycle) / power->duty_cycle;
+    radio_scanner_app_set_tick_period(app, sleep_ms);
+    scanner_trace_record(ScannerTraceEventSleep, 0, sleep_ms);
+}
+
+/**
+ * Wakes the radio from low-power sleep and resumes reception on the current frequency.
+ * Does nothing when the radio is awake.
+ */
+void radio_scanner_power_wake(RadioScannerApp* app) {
+    furi_assert(app);
+    RadioScannerPower* power = &app->power;
+    if(!power->asleep) {
+        return;
+    }
+    radio_scanner_power_account(power);
+    radio_scanner_power_update_battery(power);
 
+    // Register contents are not guaranteed across power down, reload the preset
     subghz_devices_idle(app->radio_device);
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Device set to idle");
-#endif
-    app->frequency = new_frequency;
-    subghz_devices_set_frequency(app->radio_device, app->frequency);
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Frequency set to %lu", app->frequency);
-#endif
+    subghz_devices_load_preset(app->radio_device, FuriHalSubGhzPreset2FSKDev238Async, NULL);
+    power->asleep = false;
+    power->burst_ticks = 0;
+    radio_scanner_tune(app, app->frequency);
+    // The first reading of the burst follows right after the wake
+    furi_delay_us(RADIO_SCANNER_RSSI_SETTLE_US);
 
-    subghz_devices_start_async_rx(app->radio_device, radio_scanner_rx_callback, app);
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Asynchronous RX restarted");
-    FURI_LOG_D(TAG, "Exit radio_scanner_process_scanning");
-#endif
+    radio_scanner_app_set_tick_period(app, RADIO_SCANNER_TICK_PERIOD_MS);
+    scanner_trace_record(ScannerTraceEventWake, 0, app->frequency);
+}
+
+/**
+ * Advances the low-power duty cycle by one tick.
+ * Returns false when the radio has just been put to sleep and the sweep must be skipped.
+ * A lock holds the radio awake until scanning resumes.
+ */
+bool radio_scanner_power_tick(RadioScannerApp* app) {
+    furi_assert(app);
+    RadioScannerPower* power = &app->power;
+    if(power->asleep) {
+        // The stretched tick period has elapsed, start the next burst
+        radio_scanner_power_wake(app);
+        return true;
+    }
+    if(!power->enabled || !app->scanning) {
+        power->burst_ticks = 0;
+        return true;
+    }
+    if(++power->burst_ticks < RADIO_SCANNER_POWER_BURST_TICKS) {
+        return true;
+    }
+    radio_scanner_power_sleep(app);
+    return false;
+}
+
+/**
+ * Returns the measured share of time the radio spent awake, in percent.
+ */
+uint8_t radio_scanner_power_get_active_ratio(RadioScannerApp* app) {
+    furi_assert(app);
+    RadioScannerPower* power = &app->power;
+    radio_scanner_power_account(power);
+    uint32_t total_ms = power->active_ms + power->sleep_ms;
+    if(total_ms == 0) {
+        return 100;
+    }
+    return (uint8_t)((uint64_t)power->active_ms * 100 / total_ms);
 }
 
 /**
- * Retrieves the current frequency value as a string.
+ * Retrieves the current frequency value as a string, with kHz precision.
  */
 void radio_scanner_get_frequency_str(RadioScannerApp* app, FuriString* frequency_str) {
     furi_assert(app);
     if(frequency_str != NULL) {
-        furi_string_printf(frequency_str, "%.2f", (double)app->frequency / 1000000);
+        furi_string_printf(frequency_str, "%.3f", (double)app->frequency / 1000000);
     }
 }
 
@@ -225,6 +1023,95 @@ void radio_scanner_get_sensitivity_str(RadioScannerApp* app, FuriString* sensiti
 void radio_scanner_get_scanning_str(RadioScannerApp* app, FuriString* scanning_str) {
     furi_assert(app);
     if(scanning_str != NULL) {
-        furi_string_printf(scanning_str, app->scanning ? "Scanning..." : "Locked");
+        if(!app->radio_ready) {
+            furi_string_printf(scanning_str, "Starting...");
+        } else if(app->power.asleep) {
+            furi_string_printf(scanning_str, "Sleeping");
+        } else if(app->scanning && app->scan_mode == ScanModeStore) {
+            furi_string_printf(scanning_str, "Storing... %zu", app->store.results.count);
+        } else if(app->scanning && app->scan_mode == ScanModeCapture) {
+            furi_string_printf(scanning_str, "Capture pass %u", app->monitor.passes + 1);
+        } else if(app->scan_mode == ScanModeMonitor) {
+            if(!app->monitor.baseline_valid) {
+                furi_string_printf(scanning_str, "No baseline");
+            } else if(!app->scanning) {
+                furi_string_printf(scanning_str, "New signal");
+            } else {
+                furi_string_printf(scanning_str, "Monitoring...");
+            }
+        } else {
+            furi_string_printf(scanning_str, app->scanning ? "Scanning..." : "Locked");
+        }
+    }
+}
+
+/**
+ * Retrieves the time from launch to the first RSSI reading as a string.
+ * The string is left empty until the first reading.
+ */
+void radio_scanner_get_startup_str(RadioScannerApp* app, FuriString* startup_str) {
+    furi_assert(app);
+    if(startup_str != NULL) {
+        if(app->first_rssi_ms) {
+            furi_string_printf(startup_str, "TTFR %lums", app->first_rssi_ms);
+        } else {
+            furi_string_reset(startup_str);
+        }
+    }
+}
+
+/**
+ * Retrieves the memory budget report: active profile and arena breakdown.
+ */
+void radio_scanner_get_memory_str(RadioScannerApp* app, FuriString* memory_str) {
+    furi_assert(app);
+    if(memory_str != NULL) {
+        scanner_arena_get_report(app->arena, memory_str);
+        furi_string_cat_printf(memory_str, "Profile: %s\n", app->memory_profile->name);
+    }
+}
+
+/**
+ * Retrieves the session counters as a string.
+ */
+void radio_scanner_get_stats_str(RadioScannerApp* app, FuriString* stats_str) {
+    furi_assert(app);
+    if(stats_str != NULL) {
+        const RadioScannerCarrierSense* carrier_sense = &app->carrier_sense;
+        uint32_t locks = carrier_sense->sensed_locks + carrier_sense->polled_locks;
+        furi_string_printf(
+            stats_str,
+            "CS: %lu/%lu sensed (%lu%%)\n",
+            carrier_sense->sensed_locks,
+            locks,
+            locks ? carrier_sense->sensed_locks * 100 / locks : 0);
+        furi_string_cat_printf(stats_str, "CS unconfirmed: %lu\n", carrier_sense->unconfirmed_locks);
+        furi_string_cat_printf(stats_str, "Alerts: %lu\n", app->monitor.alerts);
+        furi_string_cat_printf(
+            stats_str,
+            "Stream: %lu sent, %lu dropped\n",
+            app->stream.frames_sent,
+            app->stream.frames_dropped);
+    }
+}
+
+/**
+ * Retrieves the low-power status (measured active ratio and expected battery life) as a string.
+ * The string is left empty while low-power mode is off.
+ */
+void radio_scanner_get_power_str(RadioScannerApp* app, FuriString* power_str) {
+    furi_assert(app);
+    if(power_str != NULL) {
+        if(!app->power.enabled) {
+            furi_string_reset(power_str);
+        } else if(app->power.battery_hours) {
+            furi_string_printf(
+                power_str,
+                "%u%% ~%luh",
+                radio_scanner_power_get_active_ratio(app),
+                app->power.battery_hours);
+        } else {
+            furi_string_printf(power_str, "%u%% ~?h", radio_scanner_power_get_active_ratio(app));
+        }
     }
 }
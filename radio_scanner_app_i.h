@@ -2,12 +2,21 @@
 
 #include "scenes/radio_scanner_scene.h"
 #include "views/scanner.h"
+#include "helpers/scanner_trace.h"
+#include "helpers/scanner_store.h"
+#include "helpers/scanner_stream.h"
+#include "helpers/scanner_arena.h"
+#include "helpers/scanner_schedule.h"
+#include "helpers/scanner_baseline.h"
 
 #include <gui/gui.h>
+#include <gui/modules/submenu.h>
 #include <gui/modules/variable_item_list.h>
 #include <gui/modules/widget.h>
 #include <gui/view.h>
 #include <gui/view_dispatcher.h>
+#include <notification/notification_messages.h>
+#include <storage/storage.h>
 #include <subghz/devices/devices.h>
 
 #define TAG "RadioScannerApp"
@@ -16,17 +25,55 @@
 #define RADIO_SCANNER_DEFAULT_RSSI        (-100.0f)
 #define RADIO_SCANNER_DEFAULT_SENSITIVITY (-85.0f)
 #define RADIO_SCANNER_BUFFER_SZ           32
+#define RADIO_SCANNER_TICK_PERIOD_MS      100
+#define RADIO_SCANNER_HEAP_RESERVE        (16 * 1024)
+#define RADIO_SCANNER_RADIO_THREAD_STACK  (2 * 1024)
 
 #define SUBGHZ_FREQUENCY_MIN  300000000
 #define SUBGHZ_FREQUENCY_MAX  928000000
 #define SUBGHZ_FREQUENCY_STEP 10000
 #define SUBGHZ_DEVICE_NAME    "cc1101_int"
 
+#define RADIO_SCANNER_STATE_PATH    APP_DATA_PATH("state.bin")
+#define RADIO_SCANNER_STATE_MAGIC   0x52
+#define RADIO_SCANNER_STATE_VERSION 1
+
+#define RADIO_SCANNER_RSSI_SETTLE_US   1500
+#define RADIO_SCANNER_PEAK_COARSE_STEP  64000
+#define RADIO_SCANNER_PEAK_FINE_STEP    16000
+#define RADIO_SCANNER_PEAK_STEP_DIVIDER 4
+#define RADIO_SCANNER_PEAK_MAX_CLIMBS   3
+#define RADIO_SCANNER_PEAK_MIN_GAIN_DB  1.0f
+
+#define RADIO_SCANNER_POWER_BURST_TICKS   10
+#define RADIO_SCANNER_POWER_DEFAULT_DUTY  25
+
+#define RADIO_SCANNER_PASS_STEPS_PER_TICK 32
+
+#define RADIO_SCANNER_CS_FLOOR_DBM (-97)
+// Floor raised by the full DVGA (3 x 6 dB) and LNA (17 dB) reductions and the +7 dB threshold
+#define RADIO_SCANNER_CS_CEIL_DBM  (RADIO_SCANNER_CS_FLOOR_DBM + 3 * 6 + 17 + 7)
+#define RADIO_SCANNER_CS_PRESET_SZ 48
+
+#define RADIO_SCANNER_SCOPE_BINS           SCANNER_VIEW_SCOPE_BINS
+#define RADIO_SCANNER_SCOPE_HALF_SPAN      ((RADIO_SCANNER_SCOPE_BINS - 1) / 2)
+#define RADIO_SCANNER_SCOPE_DEFAULT_BUDGET 5
+
+#define RADIO_SCANNER_BASELINE_PATH  APP_DATA_PATH("baseline.bin")
+#define RADIO_SCANNER_DEFAULT_MARGIN 10
+#define RADIO_SCANNER_CHANNEL_COUNT                                     \
+    ((348000000 - SUBGHZ_FREQUENCY_MIN) / SUBGHZ_FREQUENCY_STEP + 1 +   \
+     (464000000 - 387000000) / SUBGHZ_FREQUENCY_STEP + 1 +              \
+     (SUBGHZ_FREQUENCY_MAX - 779000000) / SUBGHZ_FREQUENCY_STEP + 1)
+
 /**
  * Enumeration of view types used in the radio scanner app.
  */
 typedef enum {
     RadioScannerViewScanner,
+    RadioScannerViewVariableItemList,
+    RadioScannerViewSubmenu,
+    RadioScannerViewWidget,
 } RadioScannerView;
 
 /**
@@ -37,29 +84,215 @@ typedef enum {
     ScanDirectionDown,
 } ScanDirection;
 
+/**
+ * Enumeration of scan modes.
+ */
+typedef enum {
+    ScanModeSearch, // Stop on the first signal above sensitivity
+    ScanModeStore, // Sweep without stopping and list every active channel
+    ScanModeCapture, // Sweep without stopping and record the site baseline
+    ScanModeMonitor, // Stop and alert on signals above the baseline
+} ScanMode;
+
+/**
+ * Enumeration of sweep orders used by search mode.
+ */
+typedef enum {
+    ScanSweepLinear, // Step through every channel in turn
+    ScanSweepWeighted, // Visit busy channel plan segments more often and for longer
+} ScanSweep;
+
+/**
+ * State of the duty-cycled low-power mode.
+ * Times are accumulated in milliseconds to report the measured active/sleep ratio.
+ * Currents are the last fuel gauge readings at the end of each phase, in A (negative
+ * while discharging, zero until measured).
+ */
+typedef struct {
+    bool enabled;
+    uint8_t duty_cycle;
+    bool asleep;
+    uint8_t burst_ticks;
+    uint32_t phase_start;
+    uint32_t active_ms;
+    uint32_t sleep_ms;
+    float active_current;
+    float sleep_current;
+    uint32_t battery_hours;
+} RadioScannerPower;
+
+/**
+ * Scan state persisted across launches so scanning resumes where it left off.
+ */
+typedef struct {
+    uint32_t frequency;
+    float sensitivity;
+    uint8_t scan_direction;
+    bool scanning;
+} RadioScannerState;
+
+/**
+ * Sizes of the arena-backed buffers.
+ * Profiles are tried in order at startup until one fits in the free heap.
+ */
+typedef struct {
+    const char* name;
+    size_t trace_size;
+    size_t store_size;
+    uint8_t baseline_bin_shift;
+} RadioScannerMemoryProfile;
+
+/**
+ * State of a search-and-store pass.
+ * Consecutive hits form a run that is merged into one result when it ends.
+ */
+typedef struct {
+    ScannerStore results;
+    ScannerStoreEntry run;
+    uint32_t run_first;
+    uint32_t run_last;
+    bool run_active;
+    uint32_t pass_start;
+    bool pass_complete;
+} RadioScannerStoreMode;
+
+/**
+ * State of baseline capture and differential monitoring.
+ * The baseline is saved after every complete capture pass.
+ */
+typedef struct {
+    ScannerBaseline baseline;
+    bool baseline_valid;
+    uint8_t margin;
+    uint16_t passes;
+    uint32_t pass_start;
+    uint32_t alerts;
+} RadioScannerMonitor;
+
+/**
+ * How a lock taken with carrier sense armed was detected, as recorded in the trace.
+ */
+typedef enum {
+    RadioScannerCarrierSenseLockPolled, // The RSSI poll saw the signal
+    RadioScannerCarrierSenseLockSensed, // Only the radio saw it, confirmed once centered
+    RadioScannerCarrierSenseLockUnconfirmed, // Only the radio saw it, gone once centered
+} RadioScannerCarrierSenseLock;
+
+/**
+ * State of carrier-sense detection.
+ * While armed the CC1101 drives GDO0 high as soon as the RSSI crosses the programmed
+ * threshold and the edge interrupt latches it, so bursts shorter than a tick are not missed.
+ * Locks are counted by whether polling alone would have caught them.
+ * reachable is false when the threshold cannot follow the sensitivity.
+ */
+typedef struct {
+    bool enabled;
+    bool armed;
+    bool reachable;
+    volatile bool latched;
+    float sensitivity;
+    uint32_t sensed_locks;
+    uint32_t polled_locks;
+    uint32_t unconfirmed_locks;
+    uint8_t preset[RADIO_SCANNER_CS_PRESET_SZ];
+} RadioScannerCarrierSense;
+
+/**
+ * State of the band scope shown while locked.
+ * Neighbouring channels are probed a few at a time between ticks. Probing time is paid
+ * from a credit that grows by the budget share of every tick, which bounds the share
+ * of time the audio is interrupted.
+ */
+typedef struct {
+    bool enabled;
+    uint8_t budget;
+    uint32_t center;
+    uint8_t position;
+    int32_t credit_us;
+    uint32_t probe_us;
+    int8_t levels[RADIO_SCANNER_SCOPE_BINS];
+} RadioScannerScope;
+
 /**
  * Main structure for the radio scanner app.
  */
 typedef struct {
+    ScannerArena* arena;
+    const RadioScannerMemoryProfile* memory_profile;
     Gui* gui;
     uint32_t frequency;
+    uint32_t lock_frequency;
     float rssi;
     SceneManager* scene_manager;
     float sensitivity;
     bool scanning;
     ScanDirection scan_direction;
+    ScanMode scan_mode;
+    ScanSweep scan_sweep;
+    ScannerSchedule schedule;
+    uint8_t schedule_dwell;
     Scanner* scanner;
     const SubGhzDevice* radio_device;
+    FuriThread* radio_thread;
+    bool radio_ready;
+    uint32_t startup_tick;
+    uint32_t first_rssi_ms;
     bool speaker_acquired;
     ViewDispatcher* view_dispatcher;
+    NotificationApp* notifications;
+    VariableItemList* variable_item_list;
+    Submenu* submenu;
+    Widget* widget;
+    FuriString* frequency_str;
+    FuriString* rssi_str;
+    FuriString* sensitivity_str;
+    FuriString* scanning_str;
+    FuriString* power_str;
+    RadioScannerPower power;
+    ScannerTraceRecord* trace_records;
+    RadioScannerStoreMode store;
+    RadioScannerMonitor monitor;
+    RadioScannerCarrierSense carrier_sense;
+    RadioScannerScope scope;
+    ScannerStream stream;
 } RadioScannerApp;
 
+void radio_scanner_app_set_tick_period(RadioScannerApp* app, uint32_t period_ms);
+
 void radio_scanner_rx_callback(const void* data, size_t size, void* context);
 void radio_scanner_update_rssi(RadioScannerApp* app);
 bool radio_scanner_init_subghz(RadioScannerApp* app);
+void radio_scanner_start_rx(RadioScannerApp* app);
+void radio_scanner_acquire_speaker(RadioScannerApp* app);
+void radio_scanner_load_state(RadioScannerApp* app);
+void radio_scanner_save_state(RadioScannerApp* app);
+uint32_t radio_scanner_tune(RadioScannerApp* app, uint32_t frequency);
+void radio_scanner_center_on_peak(RadioScannerApp* app);
 void radio_scanner_process_scanning(RadioScannerApp* app);
 
+void radio_scanner_process_scope(RadioScannerApp* app);
+
+void radio_scanner_carrier_sense_update(RadioScannerApp* app);
+void radio_scanner_carrier_sense_disarm(RadioScannerApp* app);
+
+void radio_scanner_store_begin(RadioScannerApp* app);
+bool radio_scanner_process_store(RadioScannerApp* app);
+void radio_scanner_store_listen(RadioScannerApp* app, size_t index);
+
+size_t radio_scanner_channel_index(uint32_t frequency);
+void radio_scanner_capture_begin(RadioScannerApp* app);
+void radio_scanner_process_capture(RadioScannerApp* app);
+bool radio_scanner_monitor_begin(RadioScannerApp* app);
+
+bool radio_scanner_power_tick(RadioScannerApp* app);
+void radio_scanner_power_wake(RadioScannerApp* app);
+uint8_t radio_scanner_power_get_active_ratio(RadioScannerApp* app);
+
 void radio_scanner_get_frequency_str(RadioScannerApp* app, FuriString* frequency_str);
 void radio_scanner_get_rssi_str(RadioScannerApp* app, FuriString* rssi_str);
 void radio_scanner_get_sensitivity_str(RadioScannerApp* app, FuriString* sensitivity_str);
 void radio_scanner_get_scanning_str(RadioScannerApp* app, FuriString* scanning_str);
+void radio_scanner_get_power_str(RadioScannerApp* app, FuriString* power_str);
+void radio_scanner_get_startup_str(RadioScannerApp* app, FuriString* startup_str);
+void radio_scanner_get_memory_str(RadioScannerApp* app, FuriString* memory_str);
+void radio_scanner_get_stats_str(RadioScannerApp* app, FuriString* stats_str);
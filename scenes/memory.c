@@ -0,0 +1,39 @@
+#include "../radio_scanner_app_i.h"
+
+/**
+ * Handler called when entering the memory scene.
+ * Shows the memory budget (arena blocks, active profile and remaining heap)
+ * followed by the session counters.
+ */
+void memory_scene_on_enter(void* context) {
+    RadioScannerApp* app = context;
+
+    FuriString* memory_str = furi_string_alloc();
+    FuriString* stats_str = furi_string_alloc();
+    radio_scanner_get_memory_str(app, memory_str);
+    radio_scanner_get_stats_str(app, stats_str);
+    furi_string_cat(memory_str, stats_str);
+    widget_add_text_scroll_element(app->widget, 0, 0, 128, 64, furi_string_get_cstr(memory_str));
+    furi_string_free(stats_str);
+    furi_string_free(memory_str);
+
+    view_dispatcher_switch_to_view(app->view_dispatcher, RadioScannerViewWidget);
+}
+
+/**
+ * Handles events for the memory scene.
+ * The report is static, back navigation is left to the scene manager.
+ */
+bool memory_scene_on_event(void* context, SceneManagerEvent event) {
+    UNUSED(context);
+    UNUSED(event);
+    return false;
+}
+
+/**
+ * Handler called when exiting the memory scene.
+ */
+void memory_scene_on_exit(void* context) {
+    RadioScannerApp* app = context;
+    widget_reset(app->widget);
+}
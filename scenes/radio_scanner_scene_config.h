@@ -3,3 +3,6 @@
  * Defines the available scenes and their corresponding handler identifiers.
  */
 ADD_SCENE(scanner, Scanner)
+ADD_SCENE(settings, Settings)
+ADD_SCENE(results, Results)
+ADD_SCENE(memory, Memory)
@@ -0,0 +1,72 @@
+#include "../radio_scanner_app_i.h"
+
+#include <stdio.h>
+
+/**
+ * Submenu callback for the results list.
+ * Remembers the picked entry and notifies the scene.
+ */
+static void results_scene_submenu_callback(void* context, uint32_t index) {
+    RadioScannerApp* app = context;
+    scene_manager_set_scene_state(app->scene_manager, RadioScannerSceneResults, index);
+    view_dispatcher_send_custom_event(app->view_dispatcher, ScannerEventListenResult);
+}
+
+/**
+ * Handler called when entering the results scene.
+ * Lists every active channel found by the last search-and-store pass, sorted by frequency.
+ */
+void results_scene_on_enter(void* context) {
+    RadioScannerApp* app = context;
+    Submenu* submenu = app->submenu;
+    const ScannerStore* results = &app->store.results;
+
+    char label[RADIO_SCANNER_BUFFER_SZ + 1] = {0};
+    snprintf(label, RADIO_SCANNER_BUFFER_SZ, "%zu signals found", results->count);
+    submenu_set_header(submenu, label);
+
+    for(size_t i = 0; i < results->count; i++) {
+        const ScannerStoreEntry* entry = &results->entries[i];
+        snprintf(
+            label,
+            RADIO_SCANNER_BUFFER_SZ,
+            "%.3f %.0fdB %luk",
+            (double)entry->frequency / 1000000,
+            (double)entry->rssi,
+            entry->bandwidth / 1000);
+        submenu_add_item(submenu, label, i, results_scene_submenu_callback, app);
+    }
+
+    submenu_set_selected_item(
+        submenu, scene_manager_get_scene_state(app->scene_manager, RadioScannerSceneResults));
+
+    view_dispatcher_switch_to_view(app->view_dispatcher, RadioScannerViewSubmenu);
+}
+
+/**
+ * Handles events for the results scene.
+ * Picking an entry tunes to it and returns to the scanner scene to listen.
+ */
+bool results_scene_on_event(void* context, SceneManagerEvent event) {
+    RadioScannerApp* app = context;
+    bool consumed = false;
+
+    if(event.type == SceneManagerEventTypeCustom && event.event == ScannerEventListenResult) {
+        size_t index = scene_manager_get_scene_state(app->scene_manager, RadioScannerSceneResults);
+        radio_scanner_power_wake(app);
+        radio_scanner_store_listen(app, index);
+        FURI_LOG_I(TAG, "Listening to result %zu: %lu", index, app->frequency);
+        scene_manager_search_and_switch_to_previous_scene(app->scene_manager, RadioScannerSceneScanner);
+        consumed = true;
+    }
+
+    return consumed;
+}
+
+/**
+ * Handler called when exiting the results scene.
+ */
+void results_scene_on_exit(void* context) {
+    RadioScannerApp* app = context;
+    submenu_reset(app->submenu);
+}
@@ -1,5 +1,6 @@
 #include "../radio_scanner_app_i.h"
 #include "../views/scanner.h"
+#include "../helpers/scanner_trace.h"
 
 /**
  * Receiver callback for scanner scene events.
@@ -13,38 +14,36 @@ void scanner_scene_receiver_callback(ScannerEvent event, void* context) {
 
 /**
  * Updates the scanner scene by fetching the latest frequency, RSSI, sensitivity,
- * and scanning status, then refreshing the scanner view.
+ * scanning and low-power status and the band scope, then refreshing the scanner view.
  */
 static void scanner_scene_update(void* context) {
     RadioScannerApp* app = context;
 
-    FuriString* frequency_str;
-    FuriString* rssi_str;
-    FuriString* sensitivity_str;
-    FuriString* scanning_str;
-
-    frequency_str = furi_string_alloc();
-    rssi_str = furi_string_alloc();
-    sensitivity_str = furi_string_alloc();
-    scanning_str = furi_string_alloc();
+    radio_scanner_get_frequency_str(app, app->frequency_str);
+    radio_scanner_get_rssi_str(app, app->rssi_str);
+    radio_scanner_get_sensitivity_str(app, app->sensitivity_str);
+    radio_scanner_get_scanning_str(app, app->scanning_str);
+    radio_scanner_get_power_str(app, app->power_str);
+#ifdef FURI_DEBUG
+    if(furi_string_empty(app->power_str)) {
+        radio_scanner_get_startup_str(app, app->power_str);
+    }
+#endif
 
-    radio_scanner_get_frequency_str(app, frequency_str);
-    radio_scanner_get_rssi_str(app, rssi_str);
-    radio_scanner_get_sensitivity_str(app, sensitivity_str);
-    radio_scanner_get_scanning_str(app, scanning_str);
+    if(app->scope.enabled && app->radio_ready && !app->scanning) {
+        scanner_view_set_scope(app->scanner, app->scope.levels, RADIO_SCANNER_SCOPE_BINS);
+    } else {
+        scanner_view_set_scope(app->scanner, NULL, 0);
+    }
 
     scanner_view_update(
         app->scanner,
-        furi_string_get_cstr(frequency_str),
-        furi_string_get_cstr(rssi_str),
-        furi_string_get_cstr(sensitivity_str),
-        furi_string_get_cstr(scanning_str)
+        furi_string_get_cstr(app->frequency_str),
+        furi_string_get_cstr(app->rssi_str),
+        furi_string_get_cstr(app->sensitivity_str),
+        furi_string_get_cstr(app->scanning_str),
+        furi_string_get_cstr(app->power_str)
     );
-
-    furi_string_free(frequency_str);
-    furi_string_free(rssi_str);
-    furi_string_free(sensitivity_str);
-    furi_string_free(scanning_str);
 }
 
 /**
@@ -61,7 +60,7 @@ void scanner_scene_on_enter(void* context) {
 
 /**
  * Handles events for the scanner scene.
- * Processes custom events and tick events.
+ * Processes custom events and tick events. Any user event wakes the radio from low-power sleep.
  */
 bool scanner_scene_on_event(void* context, SceneManagerEvent event) {
     UNUSED(event);
@@ -70,20 +69,32 @@ bool scanner_scene_on_event(void* context, SceneManagerEvent event) {
     bool consumed = false;
 
     if(event.type == SceneManagerEventTypeCustom) {
+        radio_scanner_power_wake(app);
         switch(event.event) {
             // Scanning
             case ScannerEventScanDirectionDown:
                 app->scan_direction = ScanDirectionDown;
+                if(app->scan_mode == ScanModeStore) {
+                    radio_scanner_store_begin(app);
+                }
                 FURI_LOG_I(TAG, "Scan direction set to down");
                 consumed = true;
                 break;
             case ScannerEventScanDirectionUp:
                 app->scan_direction = ScanDirectionUp;
+                if(app->scan_mode == ScanModeStore) {
+                    radio_scanner_store_begin(app);
+                }
                 FURI_LOG_I(TAG, "Scan direction set to up");
                 consumed = true;
                 break;
             case ScannerEventToggleScanning:
-                app->scanning = !app->scanning;
+                // Monitoring without a baseline would alert on every signal
+                app->scanning = !app->scanning &&
+                                (app->scan_mode != ScanModeMonitor || app->monitor.baseline_valid);
+                if(app->scanning && app->scan_mode == ScanModeStore && app->store.pass_complete) {
+                    radio_scanner_store_begin(app);
+                }
                 FURI_LOG_I(TAG, "Toggled scanning: %d", app->scanning);
                 consumed = true;
                 break;
@@ -98,22 +109,37 @@ bool scanner_scene_on_event(void* context, SceneManagerEvent event) {
                 FURI_LOG_I(TAG, "Increased sensitivity: %f", (double)app->sensitivity);
                 consumed = true;
                 break;
+            // Navigation
+            case ScannerEventOpenSettings:
+                scene_manager_next_scene(app->scene_manager, RadioScannerSceneSettings);
+                consumed = true;
+                break;
             default:
                 FURI_LOG_I(TAG, "Unknown event");
                 break;
         }
     } else if(event.type == SceneManagerEventTypeTick) {
-        if(app->scanning) {
-    #ifdef FURI_DEBUG
-            FURI_LOG_D(TAG, "Scanning is active");
-    #endif
-            radio_scanner_process_scanning(app);
+        scanner_trace_record(ScannerTraceEventTick, app->scanning, app->frequency);
+        if(!app->radio_ready) {
+            // Radio bring-up still in progress
+        } else if(!radio_scanner_power_tick(app)) {
+            // Sweep burst ended, the radio is asleep until the next tick
         } else {
-    #ifdef FURI_DEBUG
-            FURI_LOG_D(TAG, "Scanning is inactive, updating RSSI");
-    #endif
-            radio_scanner_update_rssi(app);
+            radio_scanner_carrier_sense_update(app);
+            if(app->scanning && app->scan_mode == ScanModeStore) {
+                if(radio_scanner_process_store(app)) {
+                    scene_manager_next_scene(app->scene_manager, RadioScannerSceneResults);
+                }
+            } else if(app->scanning && app->scan_mode == ScanModeCapture) {
+                radio_scanner_process_capture(app);
+            } else if(app->scanning) {
+                radio_scanner_process_scanning(app);
+            } else {
+                radio_scanner_process_scope(app);
+                radio_scanner_update_rssi(app);
+            }
         }
+        scanner_stream_flush(&app->stream);
 
         scanner_scene_update(app);
 
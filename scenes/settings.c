@@ -0,0 +1,323 @@
+#include "../radio_scanner_app_i.h"
+
+#include <stdio.h>
+
+/**
+ * Items of the settings list, in display order.
+ */
+typedef enum {
+    SettingsItemMode,
+    SettingsItemSweep,
+    SettingsItemMargin,
+    SettingsItemCarrierSense,
+    SettingsItemScope,
+    SettingsItemScopeBudget,
+    SettingsItemResults,
+    SettingsItemLowPower,
+    SettingsItemDutyCycle,
+    SettingsItemStream,
+    SettingsItemMemory,
+} SettingsItem;
+
+static const char* const settings_mode_text[] = {"Search", "Store", "Capture", "Monitor"};
+static const char* const settings_sweep_text[] = {"Linear", "Weighted"};
+static const char* const settings_on_off_text[] = {"Off", "On"};
+
+static const uint8_t settings_margin_values[] = {3, 6, 10, 15, 20};
+static const char* const settings_margin_text[] = {"3 dB", "6 dB", "10 dB", "15 dB", "20 dB"};
+
+static const uint8_t settings_scope_budget_values[] = {2, 5, 10, 20};
+static const char* const settings_scope_budget_text[] = {"2%", "5%", "10%", "20%"};
+
+static const uint8_t settings_duty_cycle_values[] = {10, 25, 50, 75};
+static const char* const settings_duty_cycle_text[] = {"10%", "25%", "50%", "75%"};
+
+/**
+ * Change callback for the scan mode item.
+ * Switching to store or capture mode starts a fresh pass from the current frequency,
+ * switching to monitor mode loads the baseline and only starts scanning when there is one.
+ */
+static void settings_scene_mode_changed(VariableItem* item) {
+    RadioScannerApp* app = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+    variable_item_set_current_value_text(item, settings_mode_text[index]);
+
+    app->scan_mode = (ScanMode)index;
+    if(app->scan_mode == ScanModeStore) {
+        radio_scanner_store_begin(app);
+        app->scanning = true;
+    } else if(app->scan_mode == ScanModeCapture) {
+        radio_scanner_capture_begin(app);
+        app->scanning = true;
+    } else if(app->scan_mode == ScanModeMonitor) {
+        app->scanning = radio_scanner_monitor_begin(app);
+    }
+    FURI_LOG_I(TAG, "Scan mode: %d", app->scan_mode);
+}
+
+/**
+ * Change callback for the sweep order item.
+ * The weighted sweep starts on a fresh dwell.
+ */
+static void settings_scene_sweep_changed(VariableItem* item) {
+    RadioScannerApp* app = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+    variable_item_set_current_value_text(item, settings_sweep_text[index]);
+
+    app->scan_sweep = (ScanSweep)index;
+    app->schedule_dwell = 0;
+    FURI_LOG_I(TAG, "Sweep: %d", app->scan_sweep);
+}
+
+/**
+ * Change callback for the monitor margin item.
+ */
+static void settings_scene_margin_changed(VariableItem* item) {
+    RadioScannerApp* app = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+    variable_item_set_current_value_text(item, settings_margin_text[index]);
+
+    app->monitor.margin = settings_margin_values[index];
+    FURI_LOG_I(TAG, "Monitor margin: %u dB", app->monitor.margin);
+}
+
+/**
+ * Change callback for the carrier sense item.
+ * The radio is switched over on the next tick, clearing the lock counters.
+ */
+static void settings_scene_carrier_sense_changed(VariableItem* item) {
+    RadioScannerApp* app = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+    variable_item_set_current_value_text(item, settings_on_off_text[index]);
+
+    app->carrier_sense.enabled = (index == 1);
+    app->carrier_sense.sensed_locks = 0;
+    app->carrier_sense.polled_locks = 0;
+    app->carrier_sense.unconfirmed_locks = 0;
+    FURI_LOG_I(TAG, "Carrier sense: %d", app->carrier_sense.enabled);
+}
+
+/**
+ * Change callback for the band scope item.
+ */
+static void settings_scene_scope_changed(VariableItem* item) {
+    RadioScannerApp* app = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+    variable_item_set_current_value_text(item, settings_on_off_text[index]);
+
+    app->scope.enabled = (index == 1);
+    FURI_LOG_I(TAG, "Band scope: %d", app->scope.enabled);
+}
+
+/**
+ * Change callback for the band scope budget item.
+ */
+static void settings_scene_scope_budget_changed(VariableItem* item) {
+    RadioScannerApp* app = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+    variable_item_set_current_value_text(item, settings_scope_budget_text[index]);
+
+    app->scope.budget = settings_scope_budget_values[index];
+    FURI_LOG_I(TAG, "Band scope budget: %u%%", app->scope.budget);
+}
+
+/**
+ * Enter callback of the settings list.
+ * Opens the results of the last search-and-store pass or the memory budget report.
+ */
+static void settings_scene_enter_callback(void* context, uint32_t index) {
+    RadioScannerApp* app = context;
+    if(index == SettingsItemResults) {
+        view_dispatcher_send_custom_event(app->view_dispatcher, ScannerEventOpenResults);
+    } else if(index == SettingsItemMemory) {
+        view_dispatcher_send_custom_event(app->view_dispatcher, ScannerEventOpenMemory);
+    }
+}
+
+/**
+ * Change callback for the low-power item.
+ * Enabling the mode restarts the active/sleep measurement.
+ */
+static void settings_scene_low_power_changed(VariableItem* item) {
+    RadioScannerApp* app = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+    variable_item_set_current_value_text(item, settings_on_off_text[index]);
+
+    app->power.enabled = (index == 1);
+    app->power.burst_ticks = 0;
+    app->power.phase_start = furi_get_tick();
+    app->power.active_ms = 0;
+    app->power.sleep_ms = 0;
+    app->power.active_current = 0.0f;
+    app->power.sleep_current = 0.0f;
+    app->power.battery_hours = 0;
+    FURI_LOG_I(TAG, "Low power: %d", app->power.enabled);
+}
+
+/**
+ * Change callback for the duty cycle item.
+ */
+static void settings_scene_duty_cycle_changed(VariableItem* item) {
+    RadioScannerApp* app = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+    variable_item_set_current_value_text(item, settings_duty_cycle_text[index]);
+
+    app->power.duty_cycle = settings_duty_cycle_values[index];
+    FURI_LOG_I(TAG, "Duty cycle: %u%%", app->power.duty_cycle);
+}
+
+/**
+ * Change callback for the USB stream item.
+ * The item flips back to Off when USB cannot be switched to dual CDC.
+ */
+static void settings_scene_stream_changed(VariableItem* item) {
+    RadioScannerApp* app = variable_item_get_context(item);
+    uint8_t index = variable_item_get_current_value_index(item);
+
+    if(index) {
+        if(!scanner_stream_start(&app->stream)) {
+            index = 0;
+            variable_item_set_current_value_index(item, index);
+        }
+    } else {
+        scanner_stream_stop(&app->stream);
+    }
+    variable_item_set_current_value_text(item, settings_on_off_text[index]);
+    FURI_LOG_I(TAG, "USB stream: %d", app->stream.running);
+}
+
+/**
+ * Returns the index of a value in a table, or 0 when it is not found.
+ */
+static uint8_t settings_scene_value_index(uint8_t value, const uint8_t* values, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        if(values[i] == value) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Handler called when entering the settings scene.
+ * Populates the settings list from the current app state and switches to it.
+ */
+void settings_scene_on_enter(void* context) {
+    RadioScannerApp* app = context;
+    VariableItemList* list = app->variable_item_list;
+    VariableItem* item;
+    uint8_t index;
+    char text[RADIO_SCANNER_BUFFER_SZ + 1] = {0};
+
+    item = variable_item_list_add(
+        list, "Mode", COUNT_OF(settings_mode_text), settings_scene_mode_changed, app);
+    index = app->scan_mode;
+    variable_item_set_current_value_index(item, index);
+    variable_item_set_current_value_text(item, settings_mode_text[index]);
+
+    item = variable_item_list_add(
+        list, "Sweep", COUNT_OF(settings_sweep_text), settings_scene_sweep_changed, app);
+    index = app->scan_sweep;
+    variable_item_set_current_value_index(item, index);
+    variable_item_set_current_value_text(item, settings_sweep_text[index]);
+
+    item = variable_item_list_add(
+        list, "Margin", COUNT_OF(settings_margin_values), settings_scene_margin_changed, app);
+    index = settings_scene_value_index(
+        app->monitor.margin, settings_margin_values, COUNT_OF(settings_margin_values));
+    variable_item_set_current_value_index(item, index);
+    variable_item_set_current_value_text(item, settings_margin_text[index]);
+
+    item = variable_item_list_add(
+        list, "Carrier sense", COUNT_OF(settings_on_off_text), settings_scene_carrier_sense_changed, app);
+    index = app->carrier_sense.enabled ? 1 : 0;
+    variable_item_set_current_value_index(item, index);
+    variable_item_set_current_value_text(item, settings_on_off_text[index]);
+
+    item = variable_item_list_add(
+        list, "Band scope", COUNT_OF(settings_on_off_text), settings_scene_scope_changed, app);
+    index = app->scope.enabled ? 1 : 0;
+    variable_item_set_current_value_index(item, index);
+    variable_item_set_current_value_text(item, settings_on_off_text[index]);
+
+    item = variable_item_list_add(
+        list,
+        "Scope budget",
+        COUNT_OF(settings_scope_budget_values),
+        settings_scene_scope_budget_changed,
+        app);
+    index = settings_scene_value_index(
+        app->scope.budget, settings_scope_budget_values, COUNT_OF(settings_scope_budget_values));
+    variable_item_set_current_value_index(item, index);
+    variable_item_set_current_value_text(item, settings_scope_budget_text[index]);
+
+    item = variable_item_list_add(list, "Results", 1, NULL, app);
+    snprintf(text, RADIO_SCANNER_BUFFER_SZ, "%zu", app->store.results.count);
+    variable_item_set_current_value_text(item, text);
+
+    item = variable_item_list_add(
+        list, "Low power", COUNT_OF(settings_on_off_text), settings_scene_low_power_changed, app);
+    index = app->power.enabled ? 1 : 0;
+    variable_item_set_current_value_index(item, index);
+    variable_item_set_current_value_text(item, settings_on_off_text[index]);
+
+    item = variable_item_list_add(
+        list,
+        "Duty cycle",
+        COUNT_OF(settings_duty_cycle_values),
+        settings_scene_duty_cycle_changed,
+        app);
+    index = settings_scene_value_index(
+        app->power.duty_cycle, settings_duty_cycle_values, COUNT_OF(settings_duty_cycle_values));
+    variable_item_set_current_value_index(item, index);
+    variable_item_set_current_value_text(item, settings_duty_cycle_text[index]);
+
+    item = variable_item_list_add(
+        list, "USB stream", COUNT_OF(settings_on_off_text), settings_scene_stream_changed, app);
+    index = app->stream.running ? 1 : 0;
+    variable_item_set_current_value_index(item, index);
+    variable_item_set_current_value_text(item, settings_on_off_text[index]);
+
+    item = variable_item_list_add(list, "Memory", 1, NULL, app);
+    variable_item_set_current_value_text(item, app->memory_profile->name);
+
+    variable_item_list_set_enter_callback(list, settings_scene_enter_callback, app);
+    variable_item_list_set_selected_item(
+        list, scene_manager_get_scene_state(app->scene_manager, RadioScannerSceneSettings));
+
+    view_dispatcher_switch_to_view(app->view_dispatcher, RadioScannerViewVariableItemList);
+}
+
+/**
+ * Handles events for the settings scene.
+ * Values are applied by the item callbacks, back navigation is left to the scene manager.
+ */
+bool settings_scene_on_event(void* context, SceneManagerEvent event) {
+    RadioScannerApp* app = context;
+    bool consumed = false;
+
+    if(event.type == SceneManagerEventTypeCustom) {
+        if(event.event == ScannerEventOpenResults) {
+            scene_manager_next_scene(app->scene_manager, RadioScannerSceneResults);
+            consumed = true;
+        } else if(event.event == ScannerEventOpenMemory) {
+            scene_manager_next_scene(app->scene_manager, RadioScannerSceneMemory);
+            consumed = true;
+        }
+    }
+
+    return consumed;
+}
+
+/**
+ * Handler called when exiting the settings scene.
+ * Remembers the selected item and clears the list.
+ */
+void settings_scene_on_exit(void* context) {
+    RadioScannerApp* app = context;
+    scene_manager_set_scene_state(
+        app->scene_manager,
+        RadioScannerSceneSettings,
+        variable_item_list_get_selected_item_index(app->variable_item_list));
+    variable_item_list_reset(app->variable_item_list);
+}
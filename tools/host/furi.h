@@ -0,0 +1,20 @@
+#pragma once
+
+/**
+ * Host shim of the parts of furi.h used by the helpers built by the host tests.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define FURI_LOG_E(tag, format, ...) fprintf(stderr, "[E][%s] " format "\n", tag, ##__VA_ARGS__)
+
+#define furi_assert(condition) ((void)(condition))
+#define UNUSED(x)              (void)(x)
+
+#define MIN(a, b)              ((a) < (b) ? (a) : (b))
+#define MAX(a, b)              ((a) > (b) ? (a) : (b))
+#define CLAMP(x, upper, lower) (MIN(upper, MAX(x, lower)))
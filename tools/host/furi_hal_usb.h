@@ -0,0 +1,15 @@
+#pragma once
+
+/**
+ * Host shim of the USB configuration API, switching always succeeds.
+ */
+
+#include <stdbool.h>
+
+typedef struct FuriHalUsbInterface FuriHalUsbInterface;
+
+extern FuriHalUsbInterface usb_cdc_dual;
+
+FuriHalUsbInterface* furi_hal_usb_get_config(void);
+bool furi_hal_usb_set_config(FuriHalUsbInterface* config, void* context);
+void furi_hal_usb_unlock(void);
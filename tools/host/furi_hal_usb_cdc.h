@@ -0,0 +1,30 @@
+#pragma once
+
+/**
+ * Host shim of the USB CDC API, implemented by the host test driver.
+ */
+
+#include <stdint.h>
+
+struct usb_cdc_line_coding;
+
+typedef enum {
+    CdcStateDisconnected,
+    CdcStateConnected,
+} CdcState;
+
+typedef enum {
+    CdcCtrlLineDTR = (1 << 0),
+    CdcCtrlLineRTS = (1 << 1),
+} CdcCtrlLine;
+
+typedef struct {
+    void (*tx_ep_callback)(void* context);
+    void (*rx_ep_callback)(void* context);
+    void (*state_callback)(void* context, CdcState state);
+    void (*ctrl_line_callback)(void* context, CdcCtrlLine ctrl_lines);
+    void (*config_callback)(void* context, struct usb_cdc_line_coding* config);
+} CdcCallbacks;
+
+void furi_hal_cdc_set_callbacks(uint8_t if_num, CdcCallbacks* cb, void* context);
+void furi_hal_cdc_send(uint8_t if_num, uint8_t* buf, uint16_t len);
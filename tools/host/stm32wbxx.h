@@ -0,0 +1,15 @@
+#pragma once
+
+/**
+ * Host shim of the cycle counter read by trace records.
+ */
+
+#include <stdint.h>
+
+typedef struct {
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+extern DWT_Type scanner_host_dwt;
+
+#define DWT (&scanner_host_dwt)
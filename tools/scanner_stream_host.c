@@ -0,0 +1,111 @@
+/**
+ * Host driver of helpers/scanner_stream.c for tools/scanner_stream_test.py.
+ *
+ * Runs the stream helper against the shims in tools/host and writes every frame it
+ * sends to stdout. Commands are read from stdin, one per line:
+ *   step <frequency> <rssi>   push a sweep step
+ *   lock <frequency> <rssi>   push a lock
+ *   flush                     queue the pending batch, as the scanner tick does
+ *   hold                      stop completing transmissions, frames then queue up or drop
+ *   release                   complete the transmission in flight and drain the queue
+ * The queue is drained at the end of the input, then the sent and dropped frame
+ * counts are printed to stderr.
+ */
+
+#include "scanner_stream.h"
+#include "scanner_trace.h"
+
+#include <furi.h>
+#include <furi_hal_usb_cdc.h>
+
+ScannerTrace scanner_trace = {0};
+DWT_Type scanner_host_dwt = {0};
+
+struct FuriHalUsbInterface {
+    const char* name;
+};
+
+FuriHalUsbInterface usb_cdc_dual = {"cdc_dual"};
+static FuriHalUsbInterface usb_cdc_single = {"cdc_single"};
+static FuriHalUsbInterface* usb_config = &usb_cdc_single;
+
+static CdcCallbacks* cdc_callbacks = NULL;
+static void* cdc_context = NULL;
+static bool cdc_hold = false;
+
+FuriHalUsbInterface* furi_hal_usb_get_config(void) {
+    return usb_config;
+}
+
+bool furi_hal_usb_set_config(FuriHalUsbInterface* config, void* context) {
+    UNUSED(context);
+    usb_config = config;
+    return true;
+}
+
+void furi_hal_usb_unlock(void) {
+}
+
+void furi_hal_cdc_set_callbacks(uint8_t if_num, CdcCallbacks* cb, void* context) {
+    UNUSED(if_num);
+    cdc_callbacks = cb;
+    cdc_context = context;
+}
+
+/**
+ * Writes the packet to stdout. The transmission completes at once unless held.
+ */
+void furi_hal_cdc_send(uint8_t if_num, uint8_t* buf, uint16_t len) {
+    UNUSED(if_num);
+    fwrite(buf, 1, len, stdout);
+    if(!cdc_hold) {
+        cdc_callbacks->tx_ep_callback(cdc_context);
+    }
+}
+
+/**
+ * Flushes until every queued frame is sent, as successive scanner ticks would.
+ */
+static void scanner_stream_host_drain(ScannerStream* stream) {
+    do {
+        scanner_stream_flush(stream);
+    } while(stream->queue_count);
+}
+
+int main(void) {
+    static ScannerStream stream = {0};
+    if(!scanner_stream_start(&stream)) {
+        return 1;
+    }
+    cdc_callbacks->state_callback(cdc_context, CdcStateConnected);
+    cdc_callbacks->ctrl_line_callback(cdc_context, CdcCtrlLineDTR);
+
+    char line[64];
+    while(fgets(line, sizeof(line), stdin)) {
+        unsigned long frequency;
+        float rssi;
+        if(sscanf(line, "step %lu %f", &frequency, &rssi) == 2) {
+            scanner_stream_push_step(&stream, frequency, rssi);
+        } else if(sscanf(line, "lock %lu %f", &frequency, &rssi) == 2) {
+            scanner_stream_push_lock(&stream, frequency, rssi);
+        } else if(strncmp(line, "flush", 5) == 0) {
+            scanner_stream_flush(&stream);
+        } else if(strncmp(line, "hold", 4) == 0) {
+            cdc_hold = true;
+        } else if(strncmp(line, "release", 7) == 0) {
+            cdc_hold = false;
+            cdc_callbacks->tx_ep_callback(cdc_context);
+            scanner_stream_host_drain(&stream);
+        } else {
+            fprintf(stderr, "Unknown command: %s", line);
+            return 1;
+        }
+    }
+    cdc_hold = false;
+    scanner_stream_host_drain(&stream);
+    scanner_stream_stop(&stream);
+
+    fflush(stdout);
+    fprintf(stderr, "sent %lu dropped %lu\n", (unsigned long)stream.frames_sent, (unsigned long)stream.frames_dropped);
+    return 0;
+}
@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Live spectrum of the Radio Scanner USB stream.
+
+Enable "USB stream" in the app settings. The Flipper then exposes a second
+serial port next to the CLI one (for example /dev/ttyACM1 on Linux):
+
+    ./scanner_stream_reader.py /dev/ttyACM1
+    ./scanner_stream_reader.py /dev/ttyACM1 --min 433 --max 435
+
+Frame layout mirrors helpers/scanner_stream.h.
+"""
+
+import argparse
+import os
+import shutil
+import struct
+import sys
+import termios
+import time
+
+SYNC = b"\xa5\x5a"
+HEADER_SZ = 5
+FRAME_STEPS = 1
+FRAME_LOCK = 2
+
+FREQUENCY_MIN = 300_000_000
+FREQUENCY_STEP = 10_000
+RSSI_FLOOR = -100
+
+
+def crc8(data):
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x07) & 0xFF if crc & 0x80 else (crc << 1) & 0xFF
+    return crc
+
+
+class Deframer:
+    """Splits a byte stream into (type, sequence, payload) frames, resyncing on errors."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.crc_errors = 0
+        self.lost_frames = 0
+        self.sequence = None
+
+    def feed(self, data):
+        self.buffer += data
+        while True:
+            start = self.buffer.find(SYNC)
+            if start < 0:
+                # Keep a trailing first sync byte, it may start the next frame
+                del self.buffer[: max(0, len(self.buffer) - 1)]
+                return
+            del self.buffer[:start]
+            if len(self.buffer) < HEADER_SZ:
+                return
+            size = HEADER_SZ + self.buffer[4] + 1
+            if len(self.buffer) < size:
+                return
+            frame = bytes(self.buffer[:size])
+            if crc8(frame[2:-1]) != frame[-1]:
+                self.crc_errors += 1
+                del self.buffer[:1]
+                continue
+            del self.buffer[:size]
+            sequence = frame[3]
+            if self.sequence is not None:
+                self.lost_frames += (sequence - self.sequence - 1) & 0xFF
+            self.sequence = sequence
+            yield frame[2], sequence, frame[HEADER_SZ:-1]
+
+
+def decode_steps(payload):
+    """Yields (frequency, rssi) pairs from a steps payload."""
+    for channel, rssi in struct.iter_unpack("<Hb", payload):
+        yield FREQUENCY_MIN + channel * FREQUENCY_STEP, rssi
+
+
+def decode_lock(payload):
+    """Returns (frequency, rssi) from a lock payload."""
+    frequency, rssi_cdbm = struct.unpack("<Ih", payload)
+    return frequency, rssi_cdbm / 100
+
+
+def open_port(path):
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+    attrs = termios.tcgetattr(fd)
+    # Raw mode, the baud rate is meaningless on a CDC port
+    attrs[0] = 0
+    attrs[1] = 0
+    attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+    attrs[3] = 0
+    attrs[6][termios.VMIN] = 0
+    attrs[6][termios.VTIME] = 1
+    termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    return fd
+
+
+def render(spectrum, low, high, lock, stats):
+    columns, lines = shutil.get_terminal_size()
+    width = max(10, columns - 8)
+    height = max(4, lines - 5)
+    span = (high - low) / width
+
+    levels = [RSSI_FLOOR] * width
+    for frequency, rssi in spectrum.items():
+        if low <= frequency < high:
+            column = int((frequency - low) / span)
+            levels[column] = max(levels[column], rssi)
+
+    out = ["\x1b[H\x1b[2J"]
+    for row in range(height):
+        threshold = -20 - (row + 1) * (RSSI_FLOOR + 20) / -height
+        bar = "".join("#" if level >= threshold else " " for level in levels)
+        out.append(f"{threshold:6.0f} |{bar}\n")
+    out.append(f"{'':6} +{'-' * width}\n")
+    out.append(f"{'':7}{low / 1e6:<{width // 2}.3f}{high / 1e6:>{width - width // 2}.3f}\n")
+    if lock:
+        out.append(f"Lock {lock[0] / 1e6:.4f} MHz {lock[1]:.1f} dBm  ")
+    out.append(stats + "\n")
+    sys.stdout.write("".join(out))
+    sys.stdout.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("port", help="serial device of the second Flipper CDC interface")
+    parser.add_argument("--min", type=float, default=300.0, help="lowest frequency shown, in MHz")
+    parser.add_argument("--max", type=float, default=928.0, help="highest frequency shown, in MHz")
+    parser.add_argument("--refresh", type=float, default=0.5, help="screen refresh period, in seconds")
+    args = parser.parse_args()
+
+    fd = open_port(args.port)
+    deframer = Deframer()
+    spectrum = {}
+    lock = None
+    steps = 0
+    started = last_render = time.monotonic()
+    try:
+        while True:
+            for frame_type, _, payload in deframer.feed(os.read(fd, 4096)):
+                if frame_type == FRAME_STEPS:
+                    for frequency, rssi in decode_steps(payload):
+                        spectrum[frequency] = rssi
+                        steps += 1
+                elif frame_type == FRAME_LOCK:
+                    lock = decode_lock(payload)
+            now = time.monotonic()
+            if now - last_render >= args.refresh:
+                last_render = now
+                stats = (
+                    f"{steps / (now - started):.0f} steps/s, "
+                    f"{deframer.lost_frames} lost, {deframer.crc_errors} CRC errors"
+                )
+                render(spectrum, args.min * 1e6, args.max * 1e6, lock, stats)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        os.close(fd)
+
+
+if __name__ == "__main__":
+    main()
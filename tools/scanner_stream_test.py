@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""Host test of the Radio Scanner USB stream framing.
+
+helpers/scanner_stream.c is built on the host against the shims in tools/host,
+driven by scanner_stream_host.c. The frames it sends are written to the master
+side of a pseudo-terminal standing in for the Flipper CDC port, and read back
+through the slave side with the reader of scanner_stream_reader.py:
+
+    ./scanner_stream_test.py
+
+Set CC to pick the host compiler, cc is used by default.
+"""
+
+import os
+import pty
+import shutil
+import subprocess
+import tempfile
+import time
+import unittest
+
+import scanner_stream_reader as reader
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(TOOLS_DIR)
+
+FRAME_SZ = 64
+PAYLOAD_SZ = FRAME_SZ - reader.HEADER_SZ - 1
+STEP_SZ = 3
+STEPS_PER_FRAME = PAYLOAD_SZ // STEP_SZ
+
+
+def build_driver(directory):
+    """Builds the stream helper and its host driver, returns the executable path."""
+    compiler = os.environ.get("CC", "cc")
+    if not shutil.which(compiler):
+        raise unittest.SkipTest(f"no host compiler {compiler}")
+    driver = os.path.join(directory, "scanner_stream_host")
+    subprocess.run(
+        [
+            compiler,
+            "-std=gnu17",
+            "-Wall",
+            "-Wextra",
+            "-Werror",
+            "-I" + os.path.join(TOOLS_DIR, "host"),
+            "-I" + os.path.join(REPO_DIR, "helpers"),
+            os.path.join(TOOLS_DIR, "scanner_stream_host.c"),
+            os.path.join(REPO_DIR, "helpers", "scanner_stream.c"),
+            "-o",
+            driver,
+        ],
+        check=True,
+    )
+    return driver
+
+
+def run_driver(driver, commands):
+    """Runs the driver on the given commands, returns the sent bytes and the dropped frame count."""
+    result = subprocess.run(
+        [driver], input="".join(line + "\n" for line in commands).encode(), capture_output=True, check=True
+    )
+    sent, dropped = result.stderr.decode().split()[1::2]
+    frames = bytes(result.stdout)
+    return frames, int(sent), int(dropped)
+
+
+def nearest_channel(frequency):
+    """Frequency of the grid channel a step is reported on."""
+    channel = (frequency - reader.FREQUENCY_MIN + reader.FREQUENCY_STEP // 2) // reader.FREQUENCY_STEP
+    return reader.FREQUENCY_MIN + channel * reader.FREQUENCY_STEP
+
+
+class PtyLink:
+    """A pseudo-terminal pair: the device writes to the master, the host reads the slave."""
+
+    def __init__(self):
+        self.master, slave = pty.openpty()
+        self.slave = reader.open_port(os.ttyname(slave))
+        os.close(slave)
+
+    def close(self):
+        os.close(self.slave)
+        os.close(self.master)
+
+    def transfer(self, data, deframer, expected, timeout=2.0):
+        frames = []
+        deadline = time.monotonic() + timeout
+        while data or (len(frames) < expected and time.monotonic() < deadline):
+            # Write in chunks, the pty buffer is smaller than a long capture
+            written = os.write(self.master, data[:1024]) if data else 0
+            data = data[written:]
+            frames.extend(deframer.feed(os.read(self.slave, 4096)))
+        return frames
+
+
+class StreamFramingTest(unittest.TestCase):
+    @classmethod
+    def setUpClass(cls):
+        cls.build_dir = tempfile.TemporaryDirectory()
+        cls.driver = build_driver(cls.build_dir.name)
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.build_dir.cleanup()
+
+    def setUp(self):
+        self.link = PtyLink()
+        self.deframer = reader.Deframer()
+
+    def tearDown(self):
+        self.link.close()
+
+    def test_steps_and_lock_round_trip(self):
+        # Off-grid frequencies, as left by peak centering, round to the nearest channel
+        frequencies = [433_920_000 + i * reader.FREQUENCY_STEP for i in range(STEPS_PER_FRAME - 3)]
+        frequencies += [433_924_999, 433_925_000, 300_004_000]
+        steps = [(frequency, -90 + i) for i, frequency in enumerate(frequencies)]
+        commands = [f"step {frequency} {rssi}" for frequency, rssi in steps]
+        commands.append("lock 433925000 -42.5")
+        data, sent, dropped = run_driver(self.driver, commands)
+
+        frames = self.link.transfer(data, self.deframer, 2)
+
+        self.assertEqual((sent, dropped), (2, 0))
+        self.assertEqual([(t, s) for t, s, _ in frames], [(reader.FRAME_STEPS, 0), (reader.FRAME_LOCK, 1)])
+        self.assertEqual(
+            list(reader.decode_steps(frames[0][2])), [(nearest_channel(f), rssi) for f, rssi in steps]
+        )
+        self.assertEqual(reader.decode_lock(frames[1][2]), (433_925_000, -42.5))
+        self.assertEqual(self.deframer.crc_errors, 0)
+        self.assertEqual(self.deframer.lost_frames, 0)
+
+    def test_many_frames_in_order(self):
+        count = 1000
+        frequencies = (300_000_000 + i * reader.FREQUENCY_STEP for i in range(count * STEPS_PER_FRAME))
+        commands = [f"step {frequency} -80" for frequency in frequencies]
+        data, sent, dropped = run_driver(self.driver, commands)
+
+        frames = self.link.transfer(data, self.deframer, count)
+
+        self.assertEqual((sent, dropped), (count, 0))
+        self.assertEqual([s for _, s, _ in frames], [s & 0xFF for s in range(count)])
+        self.assertEqual(self.deframer.crc_errors, 0)
+        self.assertEqual(self.deframer.lost_frames, 0)
+
+    def test_resync_after_corruption(self):
+        commands = ["lock 868000000 -60", "lock 868010000 -61", "lock 868020000 -62"]
+        data, _, _ = run_driver(self.driver, commands)
+        frame_size = len(data) // 3
+        good, corrupted, after = (bytearray(data[i * frame_size : (i + 1) * frame_size]) for i in range(3))
+        corrupted[7] ^= 0xFF
+
+        frames = self.link.transfer(b"\x00\xa5" + good + corrupted + b"\x5a\xa5" + after, self.deframer, 2)
+
+        self.assertEqual([s for _, s, _ in frames], [0, 2])
+        self.assertEqual(reader.decode_lock(frames[1][2]), (868_020_000, -62.0))
+        self.assertGreaterEqual(self.deframer.crc_errors, 1)
+        self.assertEqual(self.deframer.lost_frames, 1)
+
+    def test_dropped_frames_counted_across_sequence_wrap(self):
+        # A stalled host fills the queue, the frames dropped meanwhile still take a sequence number
+        # and show up as a gap once the next frame gets through
+        commands = ["lock 915000000 -70"] * 250 + ["hold"] + ["lock 915010000 -71"] * 20
+        commands += ["release", "lock 915020000 -72"]
+        data, sent, dropped = run_driver(self.driver, commands)
+
+        frames = self.link.transfer(data, self.deframer, sent)
+
+        self.assertGreater(dropped, 0)
+        self.assertEqual(sent + dropped, 271)
+        self.assertEqual(len(frames), sent)
+        self.assertEqual(frames[-1][1], 270 & 0xFF)
+        self.assertEqual(self.deframer.lost_frames, dropped)
+
+
+if __name__ == "__main__":
+    unittest.main()
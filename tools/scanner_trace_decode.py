@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+"""Decode a Radio Scanner trace dump.
+
+Capture the output of the `radio_scanner_trace` CLI command (for example with
+`screen` or `minicom` on the Flipper serial port) and feed it to this script:
+
+    ./scanner_trace_decode.py dump.txt
+    ./scanner_trace_decode.py < dump.txt
+
+Event ids mirror ScannerTraceEvent in helpers/scanner_trace.h.
+"""
+
+import argparse
+import struct
+import sys
+
+EVENTS = [
+    # Engine
+    ("Tick", "scanning", "freq"),
+    ("Tune", None, "freq"),
+    ("Rssi", "rssi", "freq"),
+    ("Lock", "rssi", "freq"),
+    ("Unlock", None, "freq"),
+    ("PeakCentered", "retunes", "freq"),
+    # Power
+    ("Sleep", None, "ms"),
+    ("Wake", None, "freq"),
+    # UI
+    ("DrawBegin", None, None),
+    ("DrawEnd", None, None),
+    ("Input", "key", "type"),
+    # Store
+    ("StoreHit", "rssi", "freq"),
+    ("StorePass", "results", "freq"),
+    # Stream
+    ("StreamFrame", "queued", "dropped"),
+    # Schedule
+    ("ScheduleRebuild", "visits", "weights"),
+    # Baseline
+    ("BaselinePass", "passes", "freq"),
+    ("BaselineAlert", "rssi", "freq"),
+    # Carrier sense
+    ("CarrierSense", None, "freq"),
+    ("CarrierSenseLock", "detect", "freq"),
+    # Scope
+    ("ScopeSlice", "probes", "us"),
+]
+
+# RadioScannerCarrierSenseLock, the detection of a lock taken with carrier sense armed
+CARRIER_SENSE_LOCKS = ["polled", "sensed", "unconfirmed"]
+
+
+def format_arg(kind, value):
+    if kind == "rssi":
+        return f"{value / 100:.2f} dBm"
+    if kind == "freq":
+        return f"{value / 1e6:.4f} MHz"
+    if kind == "detect":
+        return CARRIER_SENSE_LOCKS[value] if 0 <= value < len(CARRIER_SENSE_LOCKS) else str(value)
+    if kind == "ms":
+        return f"{value} ms"
+    if kind == "us":
+        return f"{value} us"
+    if kind == "weights":
+        # One nibble per channel plan segment, lowest segment first
+        return "/".join(str((value >> (i * 4)) & 0xF) for i in range(8))
+    return str(value)
+
+
+def parse_dump(lines):
+    """Returns the dump header and the (timestamp, event, arg0, arg1) records."""
+    header = None
+    records = []
+    for line in lines:
+        line = line.strip()
+        if line.startswith("RSTRACE END"):
+            break
+        if line.startswith("RSTRACE "):
+            version, count, dropped, cpu_hz = (int(x) for x in line.split()[1:5])
+            if version != 1:
+                raise ValueError(f"unsupported dump version {version}")
+            header = {"count": count, "dropped": dropped, "cpu_hz": cpu_hz}
+            records = []
+            continue
+        if header is None or len(line) != 24:
+            continue
+        records.append(struct.unpack(">IHhI", bytes.fromhex(line)))
+    if header is None:
+        raise ValueError("no RSTRACE header found")
+    return header, records
+
+
+def track_ticks(ticks, event, time_us):
+    """Collects [tick start, last engine event] pairs, UI events run on their own and are skipped."""
+    name = EVENTS[event][0] if event < len(EVENTS) else None
+    if name == "Tick":
+        ticks.append([time_us, time_us])
+    elif ticks and name not in ("DrawBegin", "DrawEnd", "Input"):
+        ticks[-1][1] = time_us
+
+
+def print_tick_stats(ticks):
+    """Prints the spacing between ticks and the engine time spent in each tick."""
+    if len(ticks) < 2:
+        print("# not enough ticks")
+        return
+    spacing = [b[0] - a[0] for a, b in zip(ticks, ticks[1:])]
+    busy = [end - start for start, end in ticks[:-1]]
+    print(
+        f"# {len(ticks)} ticks, spacing mean {sum(spacing) / len(spacing):.0f} us max {max(spacing):.0f} us, "
+        f"engine time mean {sum(busy) / len(busy):.0f} us max {max(busy):.0f} us"
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("dump", nargs="?", type=argparse.FileType("r"), default=sys.stdin)
+    parser.add_argument("--ticks", action="store_true", help="print tick spacing and engine time per tick")
+    args = parser.parse_args()
+
+    header, records = parse_dump(args.dump)
+    if header["dropped"]:
+        print(f"# {header['dropped']} older records were overwritten")
+
+    # The cycle counter is 32-bit, unwrap it assuming records are in order
+    elapsed = 0
+    previous = records[0][0] if records else 0
+    ticks = []
+    for timestamp, event, arg0, arg1 in records:
+        elapsed += (timestamp - previous) & 0xFFFFFFFF
+        previous = timestamp
+        time_us = elapsed * 1e6 / header["cpu_hz"]
+        track_ticks(ticks, event, time_us)
+
+        if event < len(EVENTS):
+            name, kind0, kind1 = EVENTS[event]
+        else:
+            name, kind0, kind1 = f"Event{event}", "arg0", "arg1"
+        fields = [f"{kind}={format_arg(kind, value)}" for kind, value in ((kind0, arg0), (kind1, arg1)) if kind]
+        print(f"{time_us:14.1f} us  {name:<16} {' '.join(fields)}")
+
+    if args.ticks:
+        print_tick_stats(ticks)
+
+    # Burst catch rate: share of confirmed carrier sense locks that RSSI polling alone would have missed
+    locks = [arg0 for _, event, arg0, _ in records if event < len(EVENTS) and EVENTS[event][0] == "CarrierSenseLock"]
+    if locks:
+        confirmed = sum(1 for arg0 in locks if arg0 != CARRIER_SENSE_LOCKS.index("unconfirmed"))
+        missed = sum(1 for arg0 in locks if arg0 == CARRIER_SENSE_LOCKS.index("sensed"))
+        print(
+            f"# {confirmed} carrier sense locks, {missed} missed by polling ({missed * 100 / max(confirmed, 1):.0f}%),"
+            f" {len(locks) - confirmed} unconfirmed"
+        )
+
+
+if __name__ == "__main__":
+    main()
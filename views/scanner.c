@@ -1,5 +1,6 @@
 #include "scanner.h"
 #include "../radio_scanner_app_i.h"
+#include "../helpers/scanner_trace.h"
 
 #include <stdio.h>
 
@@ -22,53 +23,126 @@ View* scanner_view_get_view(Scanner* scanner) {
 }
 
 /**
- * Updates the scanner view with new frequency, RSSI, sensitivity, and scanning status strings.
+ * Sets the band scope levels, in dBm, centered on the current frequency.
+ * A count of 0 hides the scope. The view is redrawn by the next update.
  */
-void scanner_view_update(Scanner* scanner, const char* frequency_str, const char* rssi_str, const char* sensitivity_str, const char* scanning_str) {
+void scanner_view_set_scope(Scanner* scanner, const int8_t* levels, uint8_t count) {
     furi_assert(scanner);
+    furi_assert(count <= SCANNER_VIEW_SCOPE_BINS);
     with_view_model(
         scanner->view,
         ScannerModel* model,
         {
-            furi_string_set_str(model->frequency_str, frequency_str);
-            furi_string_set_str(model->rssi_str, rssi_str);
-            furi_string_set_str(model->sensitivity_str, sensitivity_str);
-            furi_string_set_str(model->scanning_str, scanning_str);
+            if(count) {
+                memcpy(model->scope, levels, count);
+            }
+            model->scope_bins = count;
+        },
+        false);
+}
+
+/**
+ * Updates the scanner view with new frequency, RSSI, sensitivity, scanning and low-power status strings.
+ */
+void scanner_view_update(Scanner* scanner, const char* frequency_str, const char* rssi_str, const char* sensitivity_str, const char* scanning_str, const char* power_str) {
+    furi_assert(scanner);
+    with_view_model(
+        scanner->view,
+        ScannerModel* model,
+        {
+            strlcpy(model->frequency_str, frequency_str, SCANNER_VIEW_STR_SZ);
+            strlcpy(model->rssi_str, rssi_str, SCANNER_VIEW_STR_SZ);
+            strlcpy(model->sensitivity_str, sensitivity_str, SCANNER_VIEW_STR_SZ);
+            strlcpy(model->scanning_str, scanning_str, SCANNER_VIEW_STR_SZ);
+            strlcpy(model->power_str, power_str, SCANNER_VIEW_STR_SZ);
         },
         true);
 }
 
+/**
+ * Draws the band scope strip: one bar per channel, the center channel framed.
+ */
+static void scanner_view_draw_scope(Canvas* canvas, ScannerModel* model) {
+    const uint8_t top = 30;
+    const uint8_t height = 63 - top;
+    const uint8_t bar_width = 128 / model->scope_bins;
+    const uint8_t left = (128 - bar_width * model->scope_bins) / 2;
+
+    canvas_draw_line(canvas, 0, 63, 127, 63);
+    for(uint8_t i = 0; i < model->scope_bins; i++) {
+        int32_t level = CLAMP(model->scope[i], SCANNER_VIEW_SCOPE_CEIL, SCANNER_VIEW_SCOPE_FLOOR);
+        uint8_t bar_height = (level - SCANNER_VIEW_SCOPE_FLOOR) * height /
+                             (SCANNER_VIEW_SCOPE_CEIL - SCANNER_VIEW_SCOPE_FLOOR);
+        uint8_t x = left + i * bar_width;
+        if(bar_height) {
+            canvas_draw_box(canvas, x, 63 - bar_height, bar_width - 1, bar_height);
+        }
+        if(i == model->scope_bins / 2) {
+            canvas_draw_frame(canvas, x - 1, top, bar_width + 1, height + 1);
+        }
+    }
+}
+
+/**
+ * Draws the compact layout used with the band scope: the text is packed into the
+ * top three lines and the scope strip fills the rest of the screen.
+ */
+static void scanner_view_draw_compact(Canvas* canvas, ScannerModel* model) {
+    char str[RADIO_SCANNER_BUFFER_SZ + 1] = {0};
+    canvas_set_font(canvas, FontSecondary);
+    snprintf(str, RADIO_SCANNER_BUFFER_SZ, "Freq: %s MHz", model->frequency_str);
+    canvas_draw_str_aligned(canvas, 64, 0, AlignCenter, AlignTop, str);
+
+    snprintf(str, RADIO_SCANNER_BUFFER_SZ, "RSSI %s", model->rssi_str);
+    canvas_draw_str_aligned(canvas, 2, 10, AlignLeft, AlignTop, str);
+    snprintf(str, RADIO_SCANNER_BUFFER_SZ, "Sens %s", model->sensitivity_str);
+    canvas_draw_str_aligned(canvas, 126, 10, AlignRight, AlignTop, str);
+
+    canvas_draw_str_aligned(canvas, 2, 20, AlignLeft, AlignTop, model->scanning_str);
+    canvas_draw_str_aligned(canvas, 126, 20, AlignRight, AlignTop, model->power_str);
+
+    scanner_view_draw_scope(canvas, model);
+}
+
 /**
  * Draw callback for updating the canvas UI.
  * Displays the current frequency, RSSI, sensitivity, and scanning status.
+ * In low-power mode the status line is shared with the active ratio and battery estimate.
+ * While the band scope is shown the text is compacted above the scope strip.
  */
 void scanner_view_draw(Canvas* canvas, ScannerModel* model) {
     furi_assert(canvas);
     furi_assert(model);
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Enter scanner_view_draw");
-#endif    
+    scanner_trace_record(ScannerTraceEventDrawBegin, 0, 0);
     canvas_clear(canvas);
+    if(model->scope_bins) {
+        scanner_view_draw_compact(canvas, model);
+        scanner_trace_record(ScannerTraceEventDrawEnd, 0, 0);
+        return;
+    }
     canvas_set_font(canvas, FontPrimary);
     canvas_draw_str_aligned(canvas, 64, 2, AlignCenter, AlignTop, "Radio Scanner");
 
     canvas_set_font(canvas, FontSecondary);
     char freq_str[RADIO_SCANNER_BUFFER_SZ + 1] = {0};
-    snprintf(freq_str, RADIO_SCANNER_BUFFER_SZ, "Freq: %s MHz", furi_string_get_cstr(model->frequency_str));
+    snprintf(freq_str, RADIO_SCANNER_BUFFER_SZ, "Freq: %s MHz", model->frequency_str);
     canvas_draw_str_aligned(canvas, 64, 18, AlignCenter, AlignTop, freq_str);
 
     char rssi_str[RADIO_SCANNER_BUFFER_SZ + 1] = {0};
-    snprintf(rssi_str, RADIO_SCANNER_BUFFER_SZ, "RSSI: %s", furi_string_get_cstr(model->rssi_str));
+    snprintf(rssi_str, RADIO_SCANNER_BUFFER_SZ, "RSSI: %s", model->rssi_str);
     canvas_draw_str_aligned(canvas, 64, 30, AlignCenter, AlignTop, rssi_str);
 
     char sensitivity_str[RADIO_SCANNER_BUFFER_SZ + 1] = {0};
-    snprintf(sensitivity_str, RADIO_SCANNER_BUFFER_SZ, "Sens: %s", furi_string_get_cstr(model->sensitivity_str));
+    snprintf(sensitivity_str, RADIO_SCANNER_BUFFER_SZ, "Sens: %s", model->sensitivity_str);
     canvas_draw_str_aligned(canvas, 64, 42, AlignCenter, AlignTop, sensitivity_str);
 
-    canvas_draw_str_aligned(canvas, 64, 54, AlignCenter, AlignTop, furi_string_get_cstr(model->scanning_str));
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Exit scanner_view_draw");
-#endif
+    if(model->power_str[0]) {
+        canvas_draw_str_aligned(canvas, 2, 54, AlignLeft, AlignTop, model->scanning_str);
+        canvas_draw_str_aligned(canvas, 126, 54, AlignRight, AlignTop, model->power_str);
+    } else {
+        canvas_draw_str_aligned(canvas, 64, 54, AlignCenter, AlignTop, model->scanning_str);
+    }
+    scanner_trace_record(ScannerTraceEventDrawEnd, 0, 0);
 }
 
 /**
@@ -78,10 +152,7 @@ void scanner_view_draw(Canvas* canvas, ScannerModel* model) {
 bool scanner_view_input(InputEvent* event, void* context) {
     furi_assert(context);
     Scanner* scanner = context;
-#ifdef FURI_DEBUG
-    FURI_LOG_D(TAG, "Enter scanner_view_input");
-    FURI_LOG_D(TAG, "Input event: type=%d, key=%d", event->type, event->key);
-#endif
+    scanner_trace_record(ScannerTraceEventInput, event->key, event->type);
     bool consumed = false;
     if(event->type == InputTypeShort) {
         switch(event->key) {
@@ -109,8 +180,10 @@ bool scanner_view_input(InputEvent* event, void* context) {
                 FURI_LOG_I(TAG, "Unknown input");
                 break;
         }
+    } else if(event->type == InputTypeLong && event->key == InputKeyOk) {
+        scanner->callback(ScannerEventOpenSettings, scanner->context);
+        consumed = true;
     }
-    FURI_LOG_D(TAG, "Exit scanner_view_input");
     return consumed;
 }
 
@@ -129,11 +202,11 @@ void scanner_view_exit(void* context) {
 }
 
 /**
- * Allocates and initializes a new Scanner instance.
+ * Allocates and initializes a new Scanner instance, carved from the app arena.
  * Sets up the view, model, and callbacks.
  */
-Scanner* scanner_view_alloc() {
-    Scanner* scanner = malloc(sizeof(Scanner));
+Scanner* scanner_view_alloc(ScannerArena* arena) {
+    Scanner* scanner = scanner_arena_alloc_block(arena, "Scanner view", sizeof(Scanner));
 
     scanner->view = view_alloc();
 
@@ -148,10 +221,12 @@ Scanner* scanner_view_alloc() {
         scanner->view,
         ScannerModel* model,
         {
-            model->frequency_str = furi_string_alloc();
-            model->rssi_str = furi_string_alloc();
-            model->sensitivity_str = furi_string_alloc();
-            model->scanning_str = furi_string_alloc();
+            model->frequency_str[0] = '\0';
+            model->rssi_str[0] = '\0';
+            model->sensitivity_str[0] = '\0';
+            model->scanning_str[0] = '\0';
+            model->power_str[0] = '\0';
+            model->scope_bins = 0;
         },
         true
     );
@@ -161,22 +236,9 @@ Scanner* scanner_view_alloc() {
 
 /**
  * Frees the resources associated with the Scanner instance.
+ * The Scanner itself lives in the app arena and is released with it.
  */
 void scanner_view_free(Scanner* scanner) {
     furi_assert(scanner);
-
-    with_view_model(
-        scanner->view,
-        ScannerModel * model,
-        {
-            furi_string_free(model->frequency_str);
-            furi_string_free(model->rssi_str);
-            furi_string_free(model->sensitivity_str);
-            furi_string_free(model->scanning_str);
-        },
-        false);
-
     view_free(scanner->view);
-
-    free(scanner);
 }
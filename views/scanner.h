@@ -1,9 +1,15 @@
 #pragma once
 
 #include "../helpers/scanner_event.h"
+#include "../helpers/scanner_arena.h"
 
 #include <gui/view.h>
 
+#define SCANNER_VIEW_STR_SZ      24
+#define SCANNER_VIEW_SCOPE_BINS  17
+#define SCANNER_VIEW_SCOPE_FLOOR (-100)
+#define SCANNER_VIEW_SCOPE_CEIL  (-30)
+
 /**
  * Forward declaration for the Scanner structure.
  * Represents a scanner view with its associated callbacks and context.
@@ -26,19 +32,25 @@ struct Scanner {
 
 /**
  * Data model for the scanner view UI.
+ * Strings are stored inline so updates never touch the heap.
  */
 typedef struct {
-    FuriString* frequency_str;
-    FuriString* rssi_str;
-    FuriString* sensitivity_str;
-    FuriString* scanning_str;
+    char frequency_str[SCANNER_VIEW_STR_SZ];
+    char rssi_str[SCANNER_VIEW_STR_SZ];
+    char sensitivity_str[SCANNER_VIEW_STR_SZ];
+    char scanning_str[SCANNER_VIEW_STR_SZ];
+    char power_str[SCANNER_VIEW_STR_SZ];
+    int8_t scope[SCANNER_VIEW_SCOPE_BINS];
+    uint8_t scope_bins;
 } ScannerModel;
 
 void scanner_view_set_callback(Scanner* scanner, ScannerCallback callback, void* context);
 
 View* scanner_view_get_view(Scanner* scanner);
 
-void scanner_view_update(Scanner* scanner, const char* frequency_str, const char* rssi_str, const char* sensitivity_str, const char* scanning_str);
+void scanner_view_set_scope(Scanner* scanner, const int8_t* levels, uint8_t count);
+
+void scanner_view_update(Scanner* scanner, const char* frequency_str, const char* rssi_str, const char* sensitivity_str, const char* scanning_str, const char* power_str);
 
-Scanner* scanner_view_alloc();
+Scanner* scanner_view_alloc(ScannerArena* arena);
 void scanner_view_free(Scanner* scanner);